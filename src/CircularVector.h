@@ -0,0 +1,670 @@
+#ifndef AISDI_LINEAR_CIRCULARVECTOR_H
+#define AISDI_LINEAR_CIRCULARVECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "TypeTraits.h"
+
+#ifndef AISDI_CHECKED_ITERATORS
+#ifdef NDEBUG
+#define AISDI_CHECKED_ITERATORS 0
+#else
+#define AISDI_CHECKED_ITERATORS 1
+#endif
+#endif
+
+namespace aisdi {
+
+    // Vector on a ring buffer: the elements start anywhere in the buffer and wrap around its end, so both
+    // ends grow and shrink in amortized O(1) while indexing stays O(1). The capacity is a power of two,
+    // which turns the wrap into a mask. Inserting or erasing inside shifts the shorter side.
+    template<typename Type, typename Allocator = std::allocator<Type>>
+    class CircularVector {
+    public:
+        using difference_type = std::ptrdiff_t;
+        using size_type = std::size_t;
+        using value_type = Type;
+        using pointer = Type *;
+        using reference = Type &;
+        using const_pointer = const Type *;
+        using const_reference = const Type &;
+        using allocator_type = Allocator;
+
+        class ConstIterator;
+
+        class Iterator;
+
+        using iterator = Iterator;
+        using const_iterator = ConstIterator;
+
+        CircularVector() : CircularVector(allocator_type()) {}
+
+        // An empty vector owns no buffer; the first one is allocated by the first insertion.
+        explicit CircularVector(const allocator_type &allocator) noexcept
+                : allocator(allocator), storage(nullptr), capacity(0), head(0), size(0) {}
+
+        CircularVector(std::initializer_list<Type> l, const allocator_type &allocator = allocator_type())
+                : CircularVector(allocator) {
+            this->reserve(l.size());
+            for (const auto &value : l) {
+                this->append(value);
+            }
+        }
+
+        CircularVector(const CircularVector &other)
+                : CircularVector(allocator_traits::select_on_container_copy_construction(other.allocator)) {
+            this->copyFrom(other);
+        }
+
+        CircularVector(CircularVector &&other) noexcept : CircularVector(other.allocator) {
+            this->swapContents(other);
+        }
+
+        ~CircularVector() {
+            this->destroyAll();
+            this->deallocate(this->storage, this->capacity);
+        }
+
+        CircularVector &operator=(const CircularVector &other) {
+            if (this == &other) {
+                return *this;
+            }
+
+            using propagate = typename allocator_traits::propagate_on_container_copy_assignment;
+            this->destroyAll();
+            if (propagate::value && this->allocator != other.allocator) {
+                this->deallocate(this->storage, this->capacity);
+                this->storage = nullptr;
+                this->capacity = 0;
+            }
+            this->propagateAllocator(other.allocator, propagate());
+            this->copyFrom(other);
+            return *this;
+        }
+
+        CircularVector &operator=(CircularVector &&other) noexcept(
+                allocator_traits::propagate_on_container_move_assignment::value ||
+                allocator_traits::is_always_equal::value) {
+            if (this == &other) {
+                return *this;
+            }
+
+            using propagate = typename allocator_traits::propagate_on_container_move_assignment;
+            this->destroyAll();
+            if (!propagate::value && this->allocator != other.allocator) {
+                // the buffer cannot change hands, so the elements are moved one by one.
+                this->reserve(other.size);
+                for (size_type i = 0; i < other.size; ++i) {
+                    this->append(std::move(other[i]));
+                }
+                return *this;
+            }
+            this->deallocate(this->storage, this->capacity);
+            this->storage = nullptr;
+            this->capacity = 0;
+            this->propagateAllocator(std::move(other.allocator), propagate());
+            this->swapContents(other);
+            return *this;
+        }
+
+        allocator_type getAllocator() const {
+            return this->allocator;
+        }
+
+        bool isEmpty() const {
+            return this->size == 0;
+        }
+
+        size_type getSize() const {
+            return this->size;
+        }
+
+        size_type getCapacity() const {
+            return this->capacity;
+        }
+
+        // Rounds the capacity up to the next power of two.
+        void reserve(size_type capacity) {
+            if (capacity > this->capacity) {
+                this->changeCapacity(roundedCapacity(capacity));
+            }
+        }
+
+        reference operator[](size_type index) {
+            return *this->slot(index);
+        }
+
+        const_reference operator[](size_type index) const {
+            return *this->slot(index);
+        }
+
+        reference at(size_type index) {
+            this->checkIndex(index);
+            return *this->slot(index);
+        }
+
+        const_reference at(size_type index) const {
+            this->checkIndex(index);
+            return *this->slot(index);
+        }
+
+        void append(const Type &item) {
+            this->emplaceAppend(item);
+        }
+
+        void append(Type &&item) {
+            this->emplaceAppend(std::move(item));
+        }
+
+        void prepend(const Type &item) {
+            this->emplacePrepend(item);
+        }
+
+        void prepend(Type &&item) {
+            this->emplacePrepend(std::move(item));
+        }
+
+        void insert(const const_iterator &insertPosition, const Type &item) {
+            this->emplace(insertPosition, item);
+        }
+
+        void insert(const const_iterator &insertPosition, Type &&item) {
+            this->emplace(insertPosition, std::move(item));
+        }
+
+        template<typename... Args>
+        void emplaceAppend(Args &&... args) {
+            if (this->size == this->capacity) {
+                // args may refer to the current buffer, so the item is constructed before the buffer is released.
+                value_type item(std::forward<Args>(args)...);
+                this->grow();
+                allocator_traits::construct(this->allocator, this->slot(this->size), std::move(item));
+            } else {
+                allocator_traits::construct(this->allocator, this->slot(this->size), std::forward<Args>(args)...);
+            }
+            ++this->size;
+        }
+
+        template<typename... Args>
+        void emplacePrepend(Args &&... args) {
+            if (this->size == this->capacity) {
+                value_type item(std::forward<Args>(args)...);
+                this->grow();
+                allocator_traits::construct(this->allocator, this->slot(this->capacity - 1), std::move(item));
+            } else {
+                allocator_traits::construct(this->allocator, this->slot(this->capacity - 1),
+                                            std::forward<Args>(args)...);
+            }
+            this->head = (this->head - 1) & (this->capacity - 1);
+            ++this->size;
+        }
+
+        template<typename... Args>
+        void emplace(const const_iterator &position, Args &&... args) {
+            const size_type index = position.index;
+            if (index == this->size) {
+                this->emplaceAppend(std::forward<Args>(args)...);
+                return;
+            }
+            if (index == 0) {
+                this->emplacePrepend(std::forward<Args>(args)...);
+                return;
+            }
+
+            value_type item(std::forward<Args>(args)...);
+            if (index < this->size - index) {
+                // the front moves one slot back: the first element is duplicated and the rest shifted.
+                this->emplacePrepend(std::move(*this->slot(0)));
+                this->moveForward(2, 1, index - 1);
+            } else {
+                this->emplaceAppend(std::move(*this->slot(this->size - 1)));
+                this->moveBackward(index, index + 1, this->size - 2 - index);
+            }
+            *this->slot(index) = std::move(item);
+        }
+
+        Type popFirst() {
+            this->checkNotEmpty();
+            value_type first(std::move(*this->slot(0)));
+            allocator_traits::destroy(this->allocator, this->slot(0));
+            this->head = (this->head + 1) & (this->capacity - 1);
+            --this->size;
+            return first;
+        }
+
+        Type popLast() {
+            this->checkNotEmpty();
+            value_type last(std::move(*this->slot(this->size - 1)));
+            allocator_traits::destroy(this->allocator, this->slot(this->size - 1));
+            --this->size;
+            return last;
+        }
+
+        void erase(const const_iterator &position) {
+            if (position == cend()) {
+                throw std::out_of_range("Iterator is out of range");
+            }
+            this->erase(position, position + 1);
+        }
+
+        // Closes the gap by moving whichever side of it is shorter.
+        void erase(const const_iterator &firstIncluded, const const_iterator &lastExcluded) {
+            const size_type first = firstIncluded.index;
+            const size_type last = lastExcluded.index;
+            if (first == last) {
+                return;
+            }
+            const size_type count = last - first;
+            if (first < this->size - last) {
+                this->moveBackward(0, count, first);
+                this->destroy(0, count);
+                this->head = (this->head + count) & (this->capacity - 1);
+            } else {
+                this->moveForward(last, first, this->size - last);
+                this->destroy(this->size - count, this->size);
+            }
+            this->size -= count;
+        }
+
+        iterator begin() {
+            return iterator(0, *this);
+        }
+
+        iterator end() {
+            return iterator(this->size, *this);
+        }
+
+        const_iterator cbegin() const {
+            return const_iterator(0, *this);
+        }
+
+        const_iterator cend() const {
+            return const_iterator(this->size, *this);
+        }
+
+        const_iterator begin() const {
+            return cbegin();
+        }
+
+        const_iterator end() const {
+            return cend();
+        }
+
+    private:
+        using allocator_traits = std::allocator_traits<Allocator>;
+        using trivially_relocatable = std::integral_constant<bool, is_trivially_relocatable<value_type>::value>;
+
+        // The smallest buffer a growing vector allocates, as in Vector.
+        static constexpr size_type minimalCapacity = 4;
+
+        allocator_type allocator;
+        pointer storage;
+        size_type capacity;
+        // The buffer slot of the first element; the element at index i lives in slot (head + i) & (capacity - 1).
+        size_type head;
+        size_type size;
+
+        pointer slot(size_type index) const {
+            return this->storage + ((this->head + index) & (this->capacity - 1));
+        }
+
+        void checkNotEmpty() {
+            if (this->isEmpty()) {
+                throw std::logic_error("Collection is empty.");
+            }
+        }
+
+        void checkIndex(size_type index) const {
+            if (index >= this->size) {
+                throw std::out_of_range("Index is out of range");
+            }
+        }
+
+        static size_type roundedCapacity(size_type required) {
+            size_type capacity = minimalCapacity;
+            while (capacity < required) {
+                capacity *= 2;
+            }
+            return capacity;
+        }
+
+        void deallocate(pointer buffer, size_type count) {
+            if (buffer != nullptr) {
+                allocator_traits::deallocate(this->allocator, buffer, count);
+            }
+        }
+
+        // Destroys the elements at indices [first, last).
+        void destroy(size_type first, size_type last) {
+            if (std::is_trivially_destructible<value_type>::value) {
+                return;
+            }
+            for (; first != last; ++first) {
+                allocator_traits::destroy(this->allocator, this->slot(first));
+            }
+        }
+
+        void destroyAll() {
+            this->destroy(0, this->size);
+            this->head = 0;
+            this->size = 0;
+        }
+
+        void copyFrom(const CircularVector &other) {
+            this->reserve(other.size);
+            for (size_type i = 0; i < other.size; ++i) {
+                this->append(other[i]);
+            }
+        }
+
+        void swapContents(CircularVector &other) noexcept {
+            std::swap(this->storage, other.storage);
+            std::swap(this->capacity, other.capacity);
+            std::swap(this->head, other.head);
+            std::swap(this->size, other.size);
+        }
+
+        template<typename OtherAllocator>
+        void propagateAllocator(OtherAllocator &&other, std::true_type) {
+            this->allocator = std::forward<OtherAllocator>(other);
+        }
+
+        template<typename OtherAllocator>
+        void propagateAllocator(OtherAllocator &&, std::false_type) {}
+
+        // Move-assigns count elements from index source to the lower index target, as std::move would.
+        // Each step covers a run contiguous in the buffer on both sides, so trivial types are memmoved.
+        void moveForward(size_type source, size_type target, size_type count) {
+            const size_type mask = this->capacity - 1;
+            while (count != 0) {
+                const size_type from = (this->head + source) & mask;
+                const size_type to = (this->head + target) & mask;
+                size_type run = std::min(count, std::min(this->capacity - from, this->capacity - to));
+                if (to > from) {
+                    // the target wrapped past the source, whose unread part must not be overwritten.
+                    run = std::min(run, to - from);
+                }
+                std::move(this->storage + from, this->storage + from + run, this->storage + to);
+                source += run;
+                target += run;
+                count -= run;
+            }
+        }
+
+        // As moveForward, towards a higher index and starting from the back, as std::move_backward would.
+        void moveBackward(size_type source, size_type target, size_type count) {
+            const size_type mask = this->capacity - 1;
+            while (count != 0) {
+                const size_type fromEnd = ((this->head + source + count - 1) & mask) + 1;
+                const size_type toEnd = ((this->head + target + count - 1) & mask) + 1;
+                size_type run = std::min(count, std::min(fromEnd, toEnd));
+                if (toEnd < fromEnd) {
+                    run = std::min(run, fromEnd - toEnd);
+                }
+                std::move_backward(this->storage + fromEnd - run, this->storage + fromEnd, this->storage + toEnd);
+                count -= run;
+            }
+        }
+
+        void grow() {
+            this->changeCapacity(this->capacity == 0 ? minimalCapacity : this->capacity * 2);
+        }
+
+        // Moves the elements to the start of newStorage, unwrapping them. The old buffer holds no live
+        // objects afterwards.
+        void relocate(pointer newStorage, std::true_type) {
+            const size_type firstPart = std::min(this->size, this->capacity - this->head);
+            if (firstPart != 0) {
+                std::memcpy(static_cast<void *>(newStorage), this->storage + this->head,
+                            firstPart * sizeof(value_type));
+            }
+            if (firstPart != this->size) {
+                std::memcpy(static_cast<void *>(newStorage + firstPart), this->storage,
+                            (this->size - firstPart) * sizeof(value_type));
+            }
+        }
+
+        void relocate(pointer newStorage, std::false_type) {
+            size_type constructed = 0;
+            try {
+                for (; constructed < this->size; ++constructed) {
+                    allocator_traits::construct(this->allocator, newStorage + constructed,
+                                                std::move_if_noexcept(*this->slot(constructed)));
+                }
+            } catch (...) {
+                for (size_type i = 0; i < constructed; ++i) {
+                    allocator_traits::destroy(this->allocator, newStorage + i);
+                }
+                throw;
+            }
+            this->destroy(0, this->size);
+        }
+
+        void changeCapacity(size_type newCapacity) {
+            const pointer newStorage = allocator_traits::allocate(this->allocator, newCapacity);
+            try {
+                this->relocate(newStorage, trivially_relocatable());
+            } catch (...) {
+                allocator_traits::deallocate(this->allocator, newStorage, newCapacity);
+                throw;
+            }
+            this->deallocate(this->storage, this->capacity);
+            this->storage = newStorage;
+            this->capacity = newCapacity;
+            this->head = 0;
+        }
+    };
+
+    // Iterators hold an index into their vector, so the wrap of the buffer stays hidden. As with Vector's,
+    // only with AISDI_CHECKED_ITERATORS do they throw std::out_of_range when stepped or dereferenced past
+    // the bounds.
+    template<typename Type, typename Allocator>
+    class CircularVector<Type, Allocator>::ConstIterator {
+        friend class CircularVector;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = typename CircularVector::value_type;
+        using difference_type = typename CircularVector::difference_type;
+        using pointer = typename CircularVector::const_pointer;
+        using reference = typename CircularVector::const_reference;
+
+        ConstIterator() : index(0), vector(nullptr) {}
+
+        explicit ConstIterator(size_type index, const CircularVector &vector) : index(index), vector(&vector) {}
+
+        reference operator*() const {
+            this->checkIsNotEnd();
+            return *vector->slot(this->index);
+        }
+
+        pointer operator->() const {
+            return &**this;
+        }
+
+        reference operator[](difference_type d) const {
+            return *(*this + d);
+        }
+
+        ConstIterator &operator++() {
+            this->checkIsNotEnd();
+            ++this->index;
+            return *this;
+        }
+
+        ConstIterator operator++(int) {
+            const auto result = *this;
+            ++*this;
+            return result;
+        }
+
+        ConstIterator &operator--() {
+            this->checkIsNotBegin();
+            --this->index;
+            return *this;
+        }
+
+        ConstIterator operator--(int) {
+            const auto result = *this;
+            --*this;
+            return result;
+        }
+
+        ConstIterator &operator+=(difference_type d) {
+            this->index += d;
+            return *this;
+        }
+
+        ConstIterator &operator-=(difference_type d) {
+            this->index -= d;
+            return *this;
+        }
+
+        ConstIterator operator+(difference_type d) const {
+            auto result = *this;
+            result += d;
+            return result;
+        }
+
+        friend ConstIterator operator+(difference_type d, const ConstIterator &it) {
+            return it + d;
+        }
+
+        difference_type operator-(const ConstIterator &other) const {
+            return static_cast<difference_type>(this->index) - static_cast<difference_type>(other.index);
+        }
+
+        ConstIterator operator-(difference_type d) const {
+            auto result = *this;
+            result -= d;
+            return result;
+        }
+
+        bool operator==(const ConstIterator &other) const {
+            return this->index == other.index;
+        }
+
+        bool operator!=(const ConstIterator &other) const {
+            return !(*this == other);
+        }
+
+        bool operator<(const ConstIterator &other) const {
+            return this->index < other.index;
+        }
+
+        bool operator>(const ConstIterator &other) const {
+            return other < *this;
+        }
+
+        bool operator<=(const ConstIterator &other) const {
+            return !(other < *this);
+        }
+
+        bool operator>=(const ConstIterator &other) const {
+            return !(*this < other);
+        }
+
+    private:
+        size_type index;
+        const CircularVector *vector;
+
+        void checkIsNotEnd() const {
+#if AISDI_CHECKED_ITERATORS
+            if (this->index >= vector->size) {
+                throw std::out_of_range("Iterator is out of range");
+            }
+#endif
+        }
+
+        void checkIsNotBegin() const {
+#if AISDI_CHECKED_ITERATORS
+            if (this->index == 0) {
+                throw std::out_of_range("Iterator is out of range");
+            }
+#endif
+        }
+    };
+
+    template<typename Type, typename Allocator>
+    class CircularVector<Type, Allocator>::Iterator : public CircularVector<Type, Allocator>::ConstIterator {
+    public:
+        using pointer = typename CircularVector::pointer;
+        using reference = typename CircularVector::reference;
+
+        Iterator() {}
+
+        explicit Iterator(size_type index, const CircularVector &vector) : ConstIterator(index, vector) {}
+
+        Iterator(const ConstIterator &other) : ConstIterator(other) {}
+
+        Iterator &operator++() {
+            ConstIterator::operator++();
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            auto result = *this;
+            ConstIterator::operator++();
+            return result;
+        }
+
+        Iterator &operator--() {
+            ConstIterator::operator--();
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            auto result = *this;
+            ConstIterator::operator--();
+            return result;
+        }
+
+        Iterator &operator+=(difference_type d) {
+            ConstIterator::operator+=(d);
+            return *this;
+        }
+
+        Iterator &operator-=(difference_type d) {
+            ConstIterator::operator-=(d);
+            return *this;
+        }
+
+        Iterator operator+(difference_type d) const {
+            return ConstIterator::operator+(d);
+        }
+
+        friend Iterator operator+(difference_type d, const Iterator &it) {
+            return it + d;
+        }
+
+        Iterator operator-(difference_type d) const {
+            return ConstIterator::operator-(d);
+        }
+
+        using ConstIterator::operator-;
+
+        reference operator*() const {
+            // ugly cast, yet reduces code duplication.
+            return const_cast<reference>(ConstIterator::operator*());
+        }
+
+        pointer operator->() const {
+            return const_cast<pointer>(ConstIterator::operator->());
+        }
+
+        reference operator[](difference_type d) const {
+            return const_cast<reference>(ConstIterator::operator[](d));
+        }
+    };
+
+}
+
+#endif // AISDI_LINEAR_CIRCULARVECTOR_H
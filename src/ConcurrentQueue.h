@@ -0,0 +1,405 @@
+#ifndef AISDI_LINEAR_CONCURRENTQUEUE_H
+#define AISDI_LINEAR_CONCURRENTQUEUE_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "GrowthPolicy.h"
+#include "Vector.h"
+
+namespace aisdi {
+
+    // Unbounded lock-free FIFO queue for any number of producers and consumers (Michael & Scott, 1996).
+    // As in LinkedList, the nodes hang off a sentinel: head always points at a node holding no value and
+    // the first item sits in the node after it; popping makes that node the new sentinel.
+    //
+    // Popped sentinels are reclaimed with hazard pointers (Michael, 2004). A thread announces the nodes it
+    // is about to dereference in a hazard record, and a retired node is freed only once no record names
+    // it. Records are acquired per operation and reused, so the memory held is bounded by the peak number
+    // of threads operating at once, each with a short list of retired nodes.
+    template<typename Type, typename Allocator = std::allocator<Type>>
+    class ConcurrentQueue {
+    private:
+        using size_type = std::size_t;
+        using value_type = Type;
+        using pointer = Type *;
+        using reference = Type &;
+        using const_reference = const Type &;
+
+        struct node {
+            std::atomic<node *> next;
+            typename std::aligned_storage<sizeof(Type), alignof(Type)>::type storage;
+
+            node() : next(nullptr) {}
+
+            pointer value() {
+                return reinterpret_cast<pointer>(&this->storage);
+            }
+        };
+
+        using node_pointer = node *;
+
+        using allocator_traits = std::allocator_traits<Allocator>;
+        using node_allocator_type = typename allocator_traits::template rebind_alloc<node>;
+        using node_allocator_traits = std::allocator_traits<node_allocator_type>;
+        using retired_list = Vector<node_pointer, DoublingGrowth,
+                typename allocator_traits::template rebind_alloc<node_pointer>>;
+
+        // The nodes one thread is dereferencing, and the nodes it unlinked and could not free yet.
+        // Records are never freed before the queue; an inactive one is free to be taken by any thread.
+        // scanned is where reclaim gathers the hazards of all records; it belongs to the record's current
+        // holder and keeps its buffer between scans, so a scan allocates only when the records outgrow it.
+        struct hazard_record {
+            static constexpr size_type hazardCount = 2;
+
+            std::atomic<node_pointer> hazards[hazardCount];
+            std::atomic<bool> active;
+            hazard_record *next;
+            retired_list retired;
+            retired_list scanned;
+
+            explicit hazard_record(const Allocator &allocator)
+                    : hazards{}, active(true), next(nullptr), retired(allocator), scanned(allocator) {}
+        };
+
+        using record_allocator_type = typename allocator_traits::template rebind_alloc<hazard_record>;
+        using record_allocator_traits = std::allocator_traits<record_allocator_type>;
+
+        // Holds a hazard record for the duration of one operation.
+        class record_guard {
+        public:
+            explicit record_guard(ConcurrentQueue &queue) : record(queue.acquireRecord()) {}
+
+            record_guard(const record_guard &) = delete;
+
+            record_guard &operator=(const record_guard &) = delete;
+
+            ~record_guard() {
+                for (auto &hazard : this->record->hazards) {
+                    hazard.store(nullptr, std::memory_order_release);
+                }
+                this->record->active.store(false, std::memory_order_release);
+            }
+
+            hazard_record *const record;
+        };
+
+        // The record a thread used last, tried first on its next operation. Queue ids are never reused,
+        // so a hint left behind by a destroyed queue is never followed.
+        struct record_hint {
+            std::uint64_t queueId;
+            hazard_record *record;
+        };
+
+        // head and tail are written by every thread; keeping them on separate cache lines stops producers
+        // and consumers from invalidating each other's line.
+        static constexpr size_type cacheLineSize = 64;
+
+        node_allocator_type allocator;
+        const std::uint64_t id;
+        std::atomic<hazard_record *> records;
+        std::atomic<size_type> recordCount;
+        alignas(cacheLineSize) std::atomic<node_pointer> head;
+        alignas(cacheLineSize) std::atomic<node_pointer> tail;
+
+        static std::uint64_t nextQueueId() {
+            static std::atomic<std::uint64_t> lastId(0);
+            return lastId.fetch_add(1, std::memory_order_relaxed) + 1;
+        }
+
+        static record_hint &threadHint() {
+            thread_local record_hint hint{0, nullptr};
+            return hint;
+        }
+
+        template<typename... Args>
+        node_pointer createNode(Args &&... args) {
+            const node_pointer created = node_allocator_traits::allocate(this->allocator, 1);
+            ::new(static_cast<void *>(created)) node();
+            try {
+                node_allocator_traits::construct(this->allocator, created->value(), std::forward<Args>(args)...);
+            } catch (...) {
+                node_allocator_traits::deallocate(this->allocator, created, 1);
+                throw;
+            }
+            return created;
+        }
+
+        // For sentinels, whose value is gone already.
+        void freeNode(node_pointer toFree) {
+            toFree->~node();
+            node_allocator_traits::deallocate(this->allocator, toFree, 1);
+        }
+
+        hazard_record *acquireRecord() {
+            record_hint &hint = threadHint();
+            if (hint.queueId == this->id && !hint.record->active.exchange(true, std::memory_order_acquire)) {
+                return hint.record;
+            }
+
+            hazard_record *acquired = nullptr;
+            for (hazard_record *it = this->records.load(std::memory_order_acquire); it != nullptr; it = it->next) {
+                if (!it->active.load(std::memory_order_relaxed) &&
+                    !it->active.exchange(true, std::memory_order_acquire)) {
+                    acquired = it;
+                    break;
+                }
+            }
+            if (acquired == nullptr) {
+                record_allocator_type recordAllocator(this->allocator);
+                acquired = record_allocator_traits::allocate(recordAllocator, 1);
+                record_allocator_traits::construct(recordAllocator, acquired, Allocator(this->allocator));
+                acquired->next = this->records.load(std::memory_order_relaxed);
+                while (!this->records.compare_exchange_weak(acquired->next, acquired, std::memory_order_release,
+                                                            std::memory_order_relaxed));
+                this->recordCount.fetch_add(1, std::memory_order_relaxed);
+            }
+            hint.queueId = this->id;
+            hint.record = acquired;
+            return acquired;
+        }
+
+        // Loads source and announces it in the given hazard, retrying until the announcement is known to
+        // have been made before the node could be retired.
+        static node_pointer protect(hazard_record *record, size_type hazard, const std::atomic<node_pointer> &source) {
+            node_pointer protectedNode = source.load();
+            while (true) {
+                record->hazards[hazard].store(protectedNode);
+                const node_pointer current = source.load();
+                if (current == protectedNode) {
+                    return protectedNode;
+                }
+                protectedNode = current;
+            }
+        }
+
+        // Hands an unlinked sentinel over to reclamation; every so often frees what no hazard names.
+        void retire(hazard_record *record, node_pointer retiredNode) {
+            record->retired.append(retiredNode);
+            const size_type threshold = std::max<size_type>(
+                    64, 2 * hazard_record::hazardCount * this->recordCount.load(std::memory_order_relaxed));
+            if (record->retired.getSize() >= threshold) {
+                this->reclaim(record);
+            }
+        }
+
+        void reclaim(hazard_record *record) {
+            retired_list &hazards = record->scanned;
+            hazards.erase(hazards.cbegin(), hazards.cend());
+            hazards.reserve(hazard_record::hazardCount * this->recordCount.load(std::memory_order_relaxed));
+            for (hazard_record *it = this->records.load(std::memory_order_acquire); it != nullptr; it = it->next) {
+                for (const auto &hazard : it->hazards) {
+                    const node_pointer hazardous = hazard.load();
+                    if (hazardous != nullptr) {
+                        hazards.append(hazardous);
+                    }
+                }
+            }
+            std::sort(hazards.data(), hazards.data() + hazards.getSize());
+
+            retired_list &retired = record->retired;
+            size_type kept = 0;
+            for (size_type i = 0; i < retired.getSize(); ++i) {
+                const node_pointer candidate = retired.data()[i];
+                if (std::binary_search(hazards.data(), hazards.data() + hazards.getSize(), candidate)) {
+                    retired.data()[kept++] = candidate;
+                } else {
+                    this->freeNode(candidate);
+                }
+            }
+            retired.erase(retired.cbegin() + kept, retired.cend());
+        }
+
+        // Links the chain [first, last], built privately by one thread, behind the current last node.
+        void linkChain(node_pointer first, node_pointer last) {
+            record_guard guard(*this);
+            while (true) {
+                const node_pointer currentTail = protect(guard.record, 0, this->tail);
+                node_pointer next = currentTail->next.load(std::memory_order_acquire);
+                if (currentTail != this->tail.load()) {
+                    continue;
+                }
+                if (next != nullptr) {
+                    // another push linked its nodes but has not swung tail yet; it gets help.
+                    node_pointer expected = currentTail;
+                    this->tail.compare_exchange_weak(expected, next);
+                    continue;
+                }
+                if (currentTail->next.compare_exchange_weak(next, first, std::memory_order_release,
+                                                            std::memory_order_relaxed)) {
+                    node_pointer expected = currentTail;
+                    this->tail.compare_exchange_strong(expected, last);
+                    return;
+                }
+            }
+        }
+
+        // Unlinks the first item and hands it to consume as an rvalue; the item is destroyed afterwards,
+        // whether consume returns or throws.
+        template<typename Consume>
+        bool popWith(hazard_record *record, Consume consume) {
+            while (true) {
+                const node_pointer sentinel = protect(record, 0, this->head);
+                const node_pointer currentTail = this->tail.load();
+                const node_pointer first = sentinel->next.load(std::memory_order_acquire);
+                record->hazards[1].store(first);
+                if (sentinel != this->head.load()) {
+                    continue;
+                }
+                if (first == nullptr) {
+                    return false;
+                }
+                if (sentinel == currentTail) {
+                    // tail lags behind a push that has linked its node already.
+                    node_pointer expected = currentTail;
+                    this->tail.compare_exchange_weak(expected, first);
+                    continue;
+                }
+                node_pointer expected = sentinel;
+                if (this->head.compare_exchange_weak(expected, first)) {
+                    // first is the new sentinel now and its value belongs to this thread alone.
+                    const pointer value = first->value();
+                    try {
+                        consume(std::move(*value));
+                    } catch (...) {
+                        node_allocator_traits::destroy(this->allocator, value);
+                        record->hazards[1].store(nullptr, std::memory_order_release);
+                        this->retire(record, sentinel);
+                        throw;
+                    }
+                    node_allocator_traits::destroy(this->allocator, value);
+                    record->hazards[1].store(nullptr, std::memory_order_release);
+                    this->retire(record, sentinel);
+                    return true;
+                }
+            }
+        }
+
+    public:
+        using allocator_type = Allocator;
+
+        ConcurrentQueue() : ConcurrentQueue(allocator_type()) {}
+
+        explicit ConcurrentQueue(const allocator_type &allocator)
+                : allocator(allocator), id(nextQueueId()), records(nullptr), recordCount(0) {
+            const node_pointer sentinel = node_allocator_traits::allocate(this->allocator, 1);
+            ::new(static_cast<void *>(sentinel)) node();
+            this->head.store(sentinel, std::memory_order_relaxed);
+            this->tail.store(sentinel, std::memory_order_relaxed);
+        }
+
+        ConcurrentQueue(const ConcurrentQueue &) = delete;
+
+        ConcurrentQueue &operator=(const ConcurrentQueue &) = delete;
+
+        // No other thread may use the queue any more.
+        ~ConcurrentQueue() {
+            node_pointer it = this->head.load(std::memory_order_acquire);
+            const node_pointer first = it->next.load(std::memory_order_relaxed);
+            this->freeNode(it);
+            for (it = first; it != nullptr;) {
+                const node_pointer next = it->next.load(std::memory_order_relaxed);
+                node_allocator_traits::destroy(this->allocator, it->value());
+                this->freeNode(it);
+                it = next;
+            }
+
+            record_allocator_type recordAllocator(this->allocator);
+            for (hazard_record *record = this->records.load(std::memory_order_acquire); record != nullptr;) {
+                hazard_record *const next = record->next;
+                for (size_type i = 0; i < record->retired.getSize(); ++i) {
+                    this->freeNode(record->retired.data()[i]);
+                }
+                record_allocator_traits::destroy(recordAllocator, record);
+                record_allocator_traits::deallocate(recordAllocator, record, 1);
+                record = next;
+            }
+        }
+
+        allocator_type getAllocator() const {
+            return allocator_type(this->allocator);
+        }
+
+        // A snapshot which other threads may invalidate right away.
+        bool isEmpty() const {
+            record_guard guard(const_cast<ConcurrentQueue &>(*this));
+            const node_pointer sentinel = protect(guard.record, 0, this->head);
+            return sentinel->next.load(std::memory_order_acquire) == nullptr;
+        }
+
+        void push(const Type &item) {
+            this->emplace(item);
+        }
+
+        void push(Type &&item) {
+            this->emplace(std::move(item));
+        }
+
+        template<typename... Args>
+        void emplace(Args &&... args) {
+            const node_pointer created = this->createNode(std::forward<Args>(args)...);
+            this->linkChain(created, created);
+        }
+
+        // Pushes [first, last) as one block: no other item lands between them, and the whole block takes
+        // a single successful compare-and-swap on the queue.
+        template<typename InputIterator>
+        void pushRange(InputIterator first, InputIterator last) {
+            if (first == last) {
+                return;
+            }
+            const node_pointer chainFirst = this->createNode(*first);
+            node_pointer chainLast = chainFirst;
+            try {
+                for (++first; first != last; ++first) {
+                    const node_pointer created = this->createNode(*first);
+                    chainLast->next.store(created, std::memory_order_relaxed);
+                    chainLast = created;
+                }
+            } catch (...) {
+                for (node_pointer it = chainFirst; it != nullptr;) {
+                    const node_pointer next = it->next.load(std::memory_order_relaxed);
+                    node_allocator_traits::destroy(this->allocator, it->value());
+                    this->freeNode(it);
+                    it = next;
+                }
+                throw;
+            }
+            this->linkChain(chainFirst, chainLast);
+        }
+
+        // Moves the first item into item, or returns false when the queue is empty.
+        bool tryPop(Type &item) {
+            record_guard guard(*this);
+            return this->popWith(guard.record, [&item](value_type &&value) { item = std::move(value); });
+        }
+
+        // Pops up to maxCount items into out, holding one hazard record for all of them. Returns how many
+        // were popped; fewer than maxCount means the queue was found empty.
+        template<typename OutputIterator>
+        size_type popBatch(OutputIterator out, size_type maxCount) {
+            record_guard guard(*this);
+            size_type popped = 0;
+            for (; popped < maxCount; ++popped) {
+                const bool poppedOne = this->popWith(guard.record, [&out](value_type &&value) {
+                    *out = std::move(value);
+                    ++out;
+                });
+                if (!poppedOne) {
+                    break;
+                }
+            }
+            return popped;
+        }
+    };
+
+}
+
+#endif // AISDI_LINEAR_CONCURRENTQUEUE_H
@@ -0,0 +1,465 @@
+#ifndef AISDI_LINEAR_CONCURRENTVECTOR_H
+#define AISDI_LINEAR_CONCURRENTVECTOR_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "GrowthPolicy.h"
+#include "Vector.h"
+
+namespace aisdi {
+
+    // Append-only vector shared by any number of appending and reading threads. Readers never wait, and
+    // appenders only when a segment they need is still being allocated. An append claims its slots with
+    // one fetch_add and constructs the items in place. The storage is a fixed table of segments, segment k
+    // holding baseSize * 2^k slots, so nothing is ever moved and references stay valid for the vector's
+    // lifetime.
+    //
+    // Every slot carries a ready flag. Readers see the published prefix: the items up to the first slot
+    // still under construction. The appender closing a gap advances the prefix over every ready slot
+    // behind it, so a slow appender delays visibility of later items but holds up no appender.
+    template<typename Type, typename Allocator = std::allocator<Type>>
+    class ConcurrentVector {
+        // A claimed slot has to be filled, or the prefix could never be published past it.
+        static_assert(std::is_nothrow_move_constructible<Type>::value,
+                      "ConcurrentVector moves items into claimed slots, which must not fail");
+
+    public:
+        using difference_type = std::ptrdiff_t;
+        using size_type = std::size_t;
+        using value_type = Type;
+        using pointer = Type *;
+        using reference = Type &;
+        using const_pointer = const Type *;
+        using const_reference = const Type &;
+        using allocator_type = Allocator;
+
+        class ConstIterator;
+
+        using const_iterator = ConstIterator;
+        using iterator = ConstIterator;
+
+        ConcurrentVector() : ConcurrentVector(allocator_type()) {}
+
+        explicit ConcurrentVector(const allocator_type &allocator) noexcept
+                : allocator(allocator), segments{}, allocating{}, claimed(0), published(0) {}
+
+        ConcurrentVector(const ConcurrentVector &) = delete;
+
+        ConcurrentVector &operator=(const ConcurrentVector &) = delete;
+
+        // No other thread may use the vector any more.
+        ~ConcurrentVector() {
+            const size_type size = this->claimed.load(std::memory_order_acquire);
+            for (size_type k = 0; k < segmentCount; ++k) {
+                const slot_pointer segment = this->segments[k].load(std::memory_order_acquire);
+                if (segment == nullptr) {
+                    continue;
+                }
+                const size_type first = segmentStart(k);
+                for (size_type i = 0; i < segmentSize(k); ++i) {
+                    if (first + i < size && !std::is_trivially_destructible<value_type>::value) {
+                        allocator_traits::destroy(this->allocator, segment[i].value());
+                    }
+                    segment[i].~slot();
+                }
+                slot_allocator_type slotAllocator(this->allocator);
+                slot_allocator_traits::deallocate(slotAllocator, segment, segmentSize(k));
+            }
+        }
+
+        allocator_type getAllocator() const {
+            return this->allocator;
+        }
+
+        bool isEmpty() const {
+            return this->getSize() == 0;
+        }
+
+        // The published prefix; appends still in progress are not counted.
+        size_type getSize() const {
+            return this->published.load(std::memory_order_acquire);
+        }
+
+        // Allocates the segments holding the first capacity slots up front. Unlike an append, which has
+        // claimed its slots before it allocates and terminates if that fails, reserve throws bad_alloc.
+        void reserve(size_type capacity) {
+            for (size_type k = 0; k < segmentCount && segmentStart(k) < capacity; ++k) {
+                this->segmentFor(k);
+            }
+        }
+
+        // Only items of the published prefix may be read.
+        const_reference operator[](size_type index) const {
+            return *this->locate(index)->value();
+        }
+
+        const_reference at(size_type index) const {
+            if (index >= this->getSize()) {
+                throw std::out_of_range("Index is out of range");
+            }
+            return (*this)[index];
+        }
+
+        // Returns the index the item landed at. Terminates should the segment for it fail to allocate;
+        // reserve allocates ahead instead where that matters.
+        size_type append(const Type &item) {
+            return this->emplaceAppend(item);
+        }
+
+        size_type append(Type &&item) {
+            return this->emplaceAppend(std::move(item));
+        }
+
+        // An item whose construction may throw is built before its slot is claimed, then moved in.
+        template<typename... Args>
+        size_type emplaceAppend(Args &&... args) {
+            if constexpr (std::is_nothrow_constructible<value_type, Args &&...>::value) {
+                const size_type index = this->claimed.fetch_add(1);
+                this->fill(index, 1, [&](pointer destination) noexcept {
+                    allocator_traits::construct(this->allocator, destination, std::forward<Args>(args)...);
+                });
+                return index;
+            } else {
+                value_type item(std::forward<Args>(args)...);
+                return this->emplaceAppend(std::move(item));
+            }
+        }
+
+        // Claims one contiguous run for [first, last) with a single fetch_add; other appends never land
+        // inside it. Returns the index of the first item.
+        template<typename ForwardIterator>
+        size_type appendRange(ForwardIterator first, ForwardIterator last) {
+            using source_reference = typename std::iterator_traits<ForwardIterator>::reference;
+            if constexpr (std::is_nothrow_constructible<value_type, source_reference>::value) {
+                const size_type count = static_cast<size_type>(std::distance(first, last));
+                const size_type index = this->claimed.fetch_add(count);
+                this->fill(index, count, [&](pointer destination) noexcept {
+                    allocator_traits::construct(this->allocator, destination, *first);
+                    ++first;
+                });
+                return index;
+            } else {
+                Vector<value_type, OneAndHalfGrowth, allocator_type> items(this->allocator);
+                items.append(first, last);
+                return this->appendRange(std::make_move_iterator(items.begin()),
+                                         std::make_move_iterator(items.end()));
+            }
+        }
+
+        // The published prefix as of this call.
+        const_iterator begin() const {
+            return const_iterator(0, *this);
+        }
+
+        const_iterator end() const {
+            return const_iterator(this->getSize(), *this);
+        }
+
+        const_iterator cbegin() const {
+            return this->begin();
+        }
+
+        const_iterator cend() const {
+            return this->end();
+        }
+
+    private:
+        struct slot {
+            typename std::aligned_storage<sizeof(Type), alignof(Type)>::type storage;
+            std::atomic<bool> ready;
+
+            slot() noexcept : ready(false) {}
+
+            pointer value() {
+                return reinterpret_cast<pointer>(&this->storage);
+            }
+
+            const_pointer value() const {
+                return reinterpret_cast<const_pointer>(&this->storage);
+            }
+        };
+
+        using slot_pointer = slot *;
+        using allocator_traits = std::allocator_traits<Allocator>;
+        using slot_allocator_type = typename allocator_traits::template rebind_alloc<slot>;
+        using slot_allocator_traits = std::allocator_traits<slot_allocator_type>;
+
+        static constexpr size_type baseSize = 64;
+        static constexpr size_type baseShift = 6;
+        // Enough segments to address every index a size_type can hold.
+        static constexpr size_type segmentCount = std::numeric_limits<size_type>::digits - baseShift;
+
+        allocator_type allocator;
+        std::atomic<slot_pointer> segments[segmentCount];
+        std::atomic<bool> allocating[segmentCount];
+        std::atomic<size_type> claimed;
+        std::atomic<size_type> published;
+
+        static size_type floorLog2(size_type value) {
+#if defined(__GNUC__)
+            return std::numeric_limits<unsigned long long>::digits - 1 - __builtin_clzll(value);
+#else
+            size_type log = 0;
+            while (value >>= 1) {
+                ++log;
+            }
+            return log;
+#endif
+        }
+
+        static size_type segmentStart(size_type k) {
+            return baseSize * ((size_type(1) << k) - 1);
+        }
+
+        static size_type segmentSize(size_type k) {
+            return baseSize << k;
+        }
+
+        static size_type segmentOf(size_type index) {
+            return floorLog2((index >> baseShift) + 1);
+        }
+
+        // Returns the segment, allocating it if needed. One appender allocates each segment; others needing
+        // it meanwhile yield until it is installed, and take the allocation over should that one fail.
+        // Duplicate allocations would cost more than the wait.
+        slot_pointer segmentFor(size_type k) {
+            while (true) {
+                const slot_pointer segment = this->segments[k].load(std::memory_order_acquire);
+                if (segment != nullptr) {
+                    return segment;
+                }
+                if (!this->allocating[k].exchange(true, std::memory_order_acq_rel)) {
+                    return this->allocateSegment(k);
+                }
+                std::this_thread::yield();
+            }
+        }
+
+        slot_pointer allocateSegment(size_type k) {
+            slot_allocator_type slotAllocator(this->allocator);
+            slot_pointer created;
+            try {
+                created = slot_allocator_traits::allocate(slotAllocator, segmentSize(k));
+            } catch (...) {
+                this->allocating[k].store(false, std::memory_order_release);
+                throw;
+            }
+            for (size_type i = 0; i < segmentSize(k); ++i) {
+                ::new(static_cast<void *>(created + i)) slot();
+            }
+            this->segments[k].store(created, std::memory_order_release);
+            return created;
+        }
+
+        slot_pointer locate(size_type index) const {
+            const size_type k = segmentOf(index);
+            return this->segments[k].load(std::memory_order_acquire) + (index - segmentStart(k));
+        }
+
+        // Constructs count items into the claimed slots from index on, then publishes them. The appender
+        // reaching the middle of a segment allocates the next one, so appenders rarely race to allocate
+        // it. The first slot is flagged last, so a scan never stops inside the run.
+        //
+        // noexcept on purpose: should a segment fail to allocate here, the slots are claimed already and
+        // the prefix could never be published past them, so the program terminates instead of leaving
+        // the vector stuck.
+        template<typename Construct>
+        void fill(size_type index, size_type count, Construct construct) noexcept {
+            slot_pointer first = nullptr;
+            for (size_type i = index; i < index + count;) {
+                const size_type k = segmentOf(i);
+                const slot_pointer segment = this->segmentFor(k);
+                const size_type segmentEnd = std::min(index + count, segmentStart(k) + segmentSize(k));
+                const size_type middle = segmentStart(k) + segmentSize(k) / 2;
+                if (i <= middle && middle < segmentEnd && k + 1 < segmentCount) {
+                    this->segmentFor(k + 1);
+                }
+                for (; i < segmentEnd; ++i) {
+                    slot &filled = segment[i - segmentStart(k)];
+                    construct(filled.value());
+                    if (i == index) {
+                        first = &filled;
+                    } else {
+                        filled.ready.store(true, std::memory_order_release);
+                    }
+                }
+            }
+            if (first != nullptr) {
+                first->ready.store(true);
+            }
+            this->publish(index);
+        }
+
+        // Hands the prefix on once it reaches index: an appender whose run is not next in line leaves it
+        // to whoever fills the gap. Flags, claims and the prefix are sequentially consistent, so of two
+        // neighbouring appenders finishing at once at least one sees the other's run ready, and each slot
+        // is passed over once.
+        void publish(size_type index) noexcept {
+            size_type current = index;
+            if (this->published.load() != current) {
+                return;
+            }
+            while (true) {
+                size_type next = current;
+                const size_type claimedSize = this->claimed.load();
+                while (next < claimedSize) {
+                    const size_type k = segmentOf(next);
+                    const slot_pointer segment = this->segments[k].load();
+                    if (segment == nullptr || !segment[next - segmentStart(k)].ready.load()) {
+                        break;
+                    }
+                    ++next;
+                }
+                // A failed exchange means the next appender in line took over.
+                if (next == current || !this->published.compare_exchange_strong(current, next)) {
+                    return;
+                }
+                current = next;
+            }
+        }
+    };
+
+    // Iterators walk a snapshot of the published prefix, stepping through a segment by pointer.
+    template<typename Type, typename Allocator>
+    class ConcurrentVector<Type, Allocator>::ConstIterator {
+        friend class ConcurrentVector;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = typename ConcurrentVector::value_type;
+        using difference_type = typename ConcurrentVector::difference_type;
+        using pointer = typename ConcurrentVector::const_pointer;
+        using reference = typename ConcurrentVector::const_reference;
+
+        ConstIterator() : index(0), current(nullptr), segmentEnd(0), vector(nullptr) {}
+
+        explicit ConstIterator(size_type index, const ConcurrentVector &vector)
+                : index(index), current(nullptr), segmentEnd(0), vector(&vector) {}
+
+        reference operator*() const {
+            return *this->slotPointer()->value();
+        }
+
+        pointer operator->() const {
+            return &**this;
+        }
+
+        reference operator[](difference_type d) const {
+            return *(*this + d);
+        }
+
+        ConstIterator &operator++() {
+            ++this->index;
+            if (this->current != nullptr) {
+                ++this->current;
+                if (this->index == this->segmentEnd) {
+                    this->current = nullptr;
+                }
+            }
+            return *this;
+        }
+
+        ConstIterator operator++(int) {
+            const auto result = *this;
+            ++*this;
+            return result;
+        }
+
+        ConstIterator &operator--() {
+            --this->index;
+            this->current = nullptr;
+            return *this;
+        }
+
+        ConstIterator operator--(int) {
+            const auto result = *this;
+            --*this;
+            return result;
+        }
+
+        ConstIterator &operator+=(difference_type d) {
+            this->index += d;
+            this->current = nullptr;
+            return *this;
+        }
+
+        ConstIterator &operator-=(difference_type d) {
+            this->index -= d;
+            this->current = nullptr;
+            return *this;
+        }
+
+        ConstIterator operator+(difference_type d) const {
+            auto result = *this;
+            result += d;
+            return result;
+        }
+
+        friend ConstIterator operator+(difference_type d, const ConstIterator &it) {
+            return it + d;
+        }
+
+        difference_type operator-(const ConstIterator &other) const {
+            return static_cast<difference_type>(this->index) - static_cast<difference_type>(other.index);
+        }
+
+        ConstIterator operator-(difference_type d) const {
+            auto result = *this;
+            result -= d;
+            return result;
+        }
+
+        bool operator==(const ConstIterator &other) const {
+            return this->index == other.index;
+        }
+
+        bool operator!=(const ConstIterator &other) const {
+            return !(*this == other);
+        }
+
+        bool operator<(const ConstIterator &other) const {
+            return this->index < other.index;
+        }
+
+        bool operator>(const ConstIterator &other) const {
+            return other < *this;
+        }
+
+        bool operator<=(const ConstIterator &other) const {
+            return !(other < *this);
+        }
+
+        bool operator>=(const ConstIterator &other) const {
+            return !(*this < other);
+        }
+
+    private:
+        size_type index;
+        // The slot of index, looked up on first dereference and dropped when leaving its segment.
+        mutable slot_pointer current;
+        mutable size_type segmentEnd;
+        const ConcurrentVector *vector;
+
+        slot_pointer slotPointer() const {
+            if (this->current == nullptr) {
+                const size_type k = segmentOf(this->index);
+                this->current = this->vector->locate(this->index);
+                this->segmentEnd = segmentStart(k) + segmentSize(k);
+            }
+            return this->current;
+        }
+    };
+
+}
+
+#endif // AISDI_LINEAR_CONCURRENTVECTOR_H
@@ -0,0 +1,42 @@
+#ifndef AISDI_LINEAR_GROWTHPOLICY_H
+#define AISDI_LINEAR_GROWTHPOLICY_H
+
+#include <cstddef>
+
+namespace aisdi {
+
+    // A growth policy decides the capacity of the next buffer when a container runs out of space.
+    // It provides a static nextCapacity(currentCapacity, requiredCapacity, elementSize) returning a value
+    // not smaller than requiredCapacity.
+
+    template<std::size_t Numerator, std::size_t Denominator>
+    struct GeometricGrowth {
+        static_assert(Numerator > Denominator, "Growth factor has to be greater than one");
+
+        static std::size_t nextCapacity(std::size_t currentCapacity, std::size_t requiredCapacity, std::size_t) {
+            const std::size_t grown = currentCapacity / Denominator * Numerator +
+                                      currentCapacity % Denominator * Numerator / Denominator + 1;
+            return grown < requiredCapacity ? requiredCapacity : grown;
+        }
+    };
+
+    using DoublingGrowth = GeometricGrowth<2, 1>;
+
+    using OneAndHalfGrowth = GeometricGrowth<3, 2>;
+
+    // Grows as BasePolicy does, then rounds the buffer up to whole pages, so allocations map cleanly
+    // onto the pages handed out by the system allocator.
+    template<typename BasePolicy = DoublingGrowth, std::size_t PageSize = 4096>
+    struct PageRoundedGrowth {
+        static std::size_t nextCapacity(std::size_t currentCapacity, std::size_t requiredCapacity,
+                                        std::size_t elementSize) {
+            const std::size_t capacity = BasePolicy::nextCapacity(currentCapacity, requiredCapacity, elementSize);
+            const std::size_t bytes = (capacity * elementSize + PageSize - 1) / PageSize * PageSize;
+            const std::size_t rounded = bytes / elementSize;
+            return rounded < capacity ? capacity : rounded;
+        }
+    };
+
+}
+
+#endif // AISDI_LINEAR_GROWTHPOLICY_H
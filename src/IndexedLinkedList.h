@@ -0,0 +1,594 @@
+#ifndef AISDI_LINEAR_INDEXEDLINKEDLIST_H
+#define AISDI_LINEAR_INDEXEDLINKEDLIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace aisdi {
+
+    // LinkedList whose nodes also form an implicit treap: a randomized binary tree ordered by position
+    // and counting the nodes below each node. Stepping an iterator follows the list links in O(1);
+    // at(index), iterator + d and indexOf(iterator) descend or climb the tree in O(log n) expected.
+    // Inserting and erasing keep the counts up to date, which costs O(log n) expected as well.
+    template<typename Type, typename Allocator = std::allocator<Type>>
+    class IndexedLinkedList {
+    private:
+        using difference_type = std::ptrdiff_t;
+        using size_type = std::size_t;
+        using value_type = Type;
+        using pointer = Type *;
+        using reference = Type &;
+        using const_pointer = const Type *;
+        using const_reference = const Type &;
+
+        class ConstIterator;
+
+        class Iterator;
+
+        using const_iterator = ConstIterator;
+        using iterator = Iterator;
+
+        struct node_base {
+            struct node_base *next;
+            struct node_base *prev;
+
+            node_base() : next(nullptr), prev(nullptr) {}
+        };
+
+        struct node : node_base {
+            node *left;
+            node *right;
+            node *parent;
+            // nodes in the subtree rooted here, this one included.
+            size_type count;
+            std::uint32_t priority;
+            value_type value;
+
+            template<typename... Args>
+            explicit node(std::uint32_t priority, Args &&... args)
+                    : node_base(), left(nullptr), right(nullptr), parent(nullptr), count(1), priority(priority),
+                      value(std::forward<Args>(args)...) {}
+        };
+
+        using node_pointer = node_base *;
+
+        using node_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<node>;
+        using node_allocator_traits = std::allocator_traits<node_allocator_type>;
+
+        node_allocator_type allocator;
+        // The list is circular through the sentinel, as in LinkedList; the tree hangs off root.
+        node_base sentinel;
+        node *root;
+        size_type size;
+        std::uint32_t seed;
+
+        void checkNotEmpty() {
+            if (this->isEmpty()) {
+                throw std::logic_error("Collection is empty.");
+            }
+        }
+
+        static node *asNode(node_pointer base) {
+            return static_cast<node *>(base);
+        }
+
+        static size_type countOf(const node *subtree) {
+            return subtree != nullptr ? subtree->count : 0;
+        }
+
+        node_pointer endNode() const {
+            return const_cast<node_pointer>(&this->sentinel);
+        }
+
+        void resetSentinel() noexcept {
+            this->sentinel.next = this->sentinel.prev = &this->sentinel;
+        }
+
+        void relinkSentinel() noexcept {
+            if (this->size == 0) {
+                this->resetSentinel();
+            } else {
+                this->sentinel.next->prev = &this->sentinel;
+                this->sentinel.prev->next = &this->sentinel;
+            }
+        }
+
+        // xorshift32; the priorities only have to be independent of the insertion order.
+        std::uint32_t nextPriority() {
+            this->seed ^= this->seed << 13;
+            this->seed ^= this->seed >> 17;
+            this->seed ^= this->seed << 5;
+            return this->seed;
+        }
+
+        void replaceChild(node *parent, node *child, node *replacement) {
+            if (parent == nullptr) {
+                this->root = replacement;
+            } else if (parent->left == child) {
+                parent->left = replacement;
+            } else {
+                parent->right = replacement;
+            }
+            if (replacement != nullptr) {
+                replacement->parent = parent;
+            }
+        }
+
+        // Lifts child above its parent, keeping the in-order sequence and the counts.
+        void rotateUp(node *child) {
+            node *const parent = child->parent;
+            this->replaceChild(parent->parent, parent, child);
+            if (parent->left == child) {
+                parent->left = child->right;
+                if (child->right != nullptr) {
+                    child->right->parent = parent;
+                }
+                child->right = parent;
+            } else {
+                parent->right = child->left;
+                if (child->left != nullptr) {
+                    child->left->parent = parent;
+                }
+                child->left = parent;
+            }
+            parent->parent = child;
+            child->count = parent->count;
+            parent->count = countOf(parent->left) + countOf(parent->right) + 1;
+        }
+
+        // Hangs a new node in the tree right before position, then restores the heap order of priorities.
+        void attach(node *created, node_pointer position) {
+            node *parent = nullptr;
+            if (position == &this->sentinel) {
+                if (this->size != 0) {
+                    parent = asNode(this->sentinel.prev);
+                    parent->right = created;
+                }
+            } else if (asNode(position)->left == nullptr) {
+                parent = asNode(position);
+                parent->left = created;
+            } else {
+                // the predecessor is the rightmost node of position's left subtree.
+                parent = asNode(position->prev);
+                parent->right = created;
+            }
+            created->parent = parent;
+            if (parent == nullptr) {
+                this->root = created;
+            }
+            for (node *it = parent; it != nullptr; it = it->parent) {
+                ++it->count;
+            }
+            while (created->parent != nullptr && created->priority > created->parent->priority) {
+                this->rotateUp(created);
+            }
+
+            created->next = position;
+            created->prev = position->prev;
+            position->prev->next = created;
+            position->prev = created;
+        }
+
+        // Rotates the node down to a leaf and cuts it off the tree and the list.
+        void detach(node *toRemove) {
+            while (toRemove->left != nullptr || toRemove->right != nullptr) {
+                node *const child = toRemove->right == nullptr ? toRemove->left :
+                                    toRemove->left == nullptr ? toRemove->right :
+                                    toRemove->left->priority > toRemove->right->priority ? toRemove->left :
+                                    toRemove->right;
+                this->rotateUp(child);
+            }
+            this->replaceChild(toRemove->parent, toRemove, nullptr);
+            for (node *it = toRemove->parent; it != nullptr; it = it->parent) {
+                --it->count;
+            }
+
+            toRemove->prev->next = toRemove->next;
+            toRemove->next->prev = toRemove->prev;
+        }
+
+        node_pointer nodeAt(size_type index) const {
+            if (index == this->size) {
+                return this->endNode();
+            }
+            node *it = this->root;
+            for (;;) {
+                const size_type leftCount = countOf(it->left);
+                if (index < leftCount) {
+                    it = it->left;
+                } else if (index == leftCount) {
+                    return it;
+                } else {
+                    index -= leftCount + 1;
+                    it = it->right;
+                }
+            }
+        }
+
+        size_type indexOfNode(node_pointer position) const {
+            if (position == &this->sentinel) {
+                return this->size;
+            }
+            const node *it = asNode(position);
+            size_type index = countOf(it->left);
+            for (; it->parent != nullptr; it = it->parent) {
+                if (it->parent->right == it) {
+                    index += countOf(it->parent->left) + 1;
+                }
+            }
+            return index;
+        }
+
+        template<typename... Args>
+        node *createNode(Args &&... args) {
+            node *const created = node_allocator_traits::allocate(this->allocator, 1);
+            try {
+                node_allocator_traits::construct(this->allocator, created, this->nextPriority(),
+                                                 std::forward<Args>(args)...);
+            } catch (...) {
+                node_allocator_traits::deallocate(this->allocator, created, 1);
+                throw;
+            }
+            return created;
+        }
+
+        void destroyNode(node *toDelete) {
+            node_allocator_traits::destroy(this->allocator, toDelete);
+            node_allocator_traits::deallocate(this->allocator, toDelete, 1);
+        }
+
+        void swapContents(IndexedLinkedList &other) noexcept {
+            std::swap(this->sentinel, other.sentinel);
+            std::swap(this->root, other.root);
+            std::swap(this->size, other.size);
+            this->relinkSentinel();
+            other.relinkSentinel();
+        }
+
+        template<typename OtherAllocator>
+        void propagateAllocator(OtherAllocator &&other, std::true_type) {
+            this->allocator = std::forward<OtherAllocator>(other);
+        }
+
+        template<typename OtherAllocator>
+        void propagateAllocator(OtherAllocator &&, std::false_type) {}
+
+    public:
+        using allocator_type = Allocator;
+
+        IndexedLinkedList() : IndexedLinkedList(allocator_type()) {}
+
+        explicit IndexedLinkedList(const allocator_type &allocator) noexcept
+                : allocator(allocator), root(nullptr), size(0), seed(0x9e3779b9u) {
+            this->resetSentinel();
+        }
+
+        IndexedLinkedList(std::initializer_list<Type> l, const allocator_type &allocator = allocator_type())
+                : IndexedLinkedList(allocator) {
+            for (const auto &value : l) {
+                append(value);
+            }
+        }
+
+        IndexedLinkedList(const IndexedLinkedList &other)
+                : IndexedLinkedList(node_allocator_traits::select_on_container_copy_construction(other.allocator)) {
+            append(other.begin(), other.end());
+        }
+
+        IndexedLinkedList(IndexedLinkedList &&other) noexcept : IndexedLinkedList(other.allocator) {
+            swapContents(other);
+        }
+
+        ~IndexedLinkedList() {
+            clear();
+        }
+
+        IndexedLinkedList &operator=(const IndexedLinkedList &other) {
+            if (this == &other) {
+                return *this;
+            }
+
+            using propagate = typename node_allocator_traits::propagate_on_container_copy_assignment;
+            clear();
+            this->propagateAllocator(other.allocator, propagate());
+            append(other.begin(), other.end());
+            return *this;
+        }
+
+        IndexedLinkedList &operator=(IndexedLinkedList &&other) noexcept(
+                node_allocator_traits::propagate_on_container_move_assignment::value ||
+                node_allocator_traits::is_always_equal::value) {
+            if (this == &other) {
+                return *this;
+            }
+
+            using propagate = typename node_allocator_traits::propagate_on_container_move_assignment;
+            clear();
+            if (!propagate::value && this->allocator != other.allocator) {
+                // nodes cannot change hands between unequal allocators, so the values are moved one by one.
+                for (auto &value : other) {
+                    append(std::move(value));
+                }
+                return *this;
+            }
+            this->propagateAllocator(std::move(other.allocator), propagate());
+            swapContents(other);
+            return *this;
+        }
+
+        allocator_type getAllocator() const {
+            return allocator_type(this->allocator);
+        }
+
+        bool isEmpty() const {
+            return this->size == 0;
+        }
+
+        size_type getSize() const {
+            return this->size;
+        }
+
+        reference at(size_type index) {
+            return const_cast<reference>(static_cast<const IndexedLinkedList *>(this)->at(index));
+        }
+
+        const_reference at(size_type index) const {
+            if (index >= this->size) {
+                throw std::out_of_range("Index is out of range");
+            }
+            return asNode(this->nodeAt(index))->value;
+        }
+
+        size_type indexOf(const const_iterator &position) const {
+            return this->indexOfNode(position.current_node);
+        }
+
+        void append(const Type &item) {
+            emplaceAppend(item);
+        }
+
+        void append(Type &&item) {
+            emplaceAppend(std::move(item));
+        }
+
+        void append(const const_iterator &start, const const_iterator &end) {
+            for (auto it = start; it != end; ++it) {
+                append(*it);
+            }
+        }
+
+        void prepend(const Type &item) {
+            emplacePrepend(item);
+        }
+
+        void prepend(Type &&item) {
+            emplacePrepend(std::move(item));
+        }
+
+        void insert(const const_iterator &insertPosition, const Type &item) {
+            emplace(insertPosition, item);
+        }
+
+        void insert(const const_iterator &insertPosition, Type &&item) {
+            emplace(insertPosition, std::move(item));
+        }
+
+        template<typename... Args>
+        void emplaceAppend(Args &&... args) {
+            emplace(cend(), std::forward<Args>(args)...);
+        }
+
+        template<typename... Args>
+        void emplacePrepend(Args &&... args) {
+            emplace(cbegin(), std::forward<Args>(args)...);
+        }
+
+        template<typename... Args>
+        void emplace(const const_iterator &insertPosition, Args &&... args) {
+            this->attach(createNode(std::forward<Args>(args)...), insertPosition.current_node);
+            ++this->size;
+        }
+
+        Type popFirst() {
+            this->checkNotEmpty();
+            auto first = std::move(*this->begin());
+            erase(this->begin());
+            return first;
+        }
+
+        Type popLast() {
+            this->checkNotEmpty();
+            auto last = std::move(*(--this->end()));
+            erase(--this->end());
+            return last;
+        }
+
+        void erase(const const_iterator &position) {
+            if (position == end()) {
+                throw std::out_of_range("Iterator is out of range");
+            }
+            node *const toDelete = asNode(position.current_node);
+            this->detach(toDelete);
+            this->destroyNode(toDelete);
+            --this->size;
+        }
+
+        void erase(const const_iterator &firstIncluded, const const_iterator &lastExcluded) {
+            for (auto toDelete = firstIncluded; toDelete != lastExcluded;) {
+                erase(toDelete++);
+            }
+        }
+
+        void clear() {
+            for (node_pointer it = this->sentinel.next; it != &this->sentinel;) {
+                node *const toDelete = asNode(it);
+                it = it->next;
+                this->destroyNode(toDelete);
+            }
+            this->resetSentinel();
+            this->root = nullptr;
+            this->size = 0;
+        }
+
+        iterator begin() {
+            return iterator(this->sentinel.next, *this);
+        }
+
+        iterator end() {
+            return iterator(&this->sentinel, *this);
+        }
+
+        const_iterator cbegin() const {
+            return const_iterator(this->sentinel.next, *this);
+        }
+
+        const_iterator cend() const {
+            return const_iterator(this->endNode(), *this);
+        }
+
+        const_iterator begin() const {
+            return this->cbegin();
+        }
+
+        const_iterator end() const {
+            return this->cend();
+        }
+    };
+
+    template<typename Type, typename Allocator>
+    class IndexedLinkedList<Type, Allocator>::ConstIterator {
+        friend class IndexedLinkedList;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = typename IndexedLinkedList::value_type;
+        using difference_type = typename IndexedLinkedList::difference_type;
+        using pointer = typename IndexedLinkedList::const_pointer;
+        using reference = typename IndexedLinkedList::const_reference;
+
+        explicit ConstIterator(node_pointer current_node, const IndexedLinkedList &list) :
+                current_node(current_node), list(&list) {}
+
+        reference operator*() const {
+            checkIsNotEnd();
+            return asNode(this->current_node)->value;
+        }
+
+        ConstIterator &operator++() {
+            checkIsNotEnd();
+            this->current_node = this->current_node->next;
+            return *this;
+        }
+
+        ConstIterator operator++(int) {
+            const auto current = *this;
+            ++*this;
+            return current;
+        }
+
+        ConstIterator &operator--() {
+            checkIsNotBegin();
+            this->current_node = this->current_node->prev;
+            return *this;
+        }
+
+        ConstIterator operator--(int) {
+            const auto current = *this;
+            --*this;
+            return current;
+        }
+
+        // Climbs to find the own index, then descends to the target one.
+        ConstIterator operator+(difference_type d) const {
+            const difference_type target = static_cast<difference_type>(list->indexOfNode(this->current_node)) + d;
+            if (target < 0 || target > static_cast<difference_type>(list->size)) {
+                throw std::out_of_range("Iterator is out of range");
+            }
+            return ConstIterator(list->nodeAt(static_cast<size_type>(target)), *list);
+        }
+
+        ConstIterator operator-(difference_type d) const {
+            return *this + -d;
+        }
+
+        bool operator==(const ConstIterator &other) const {
+            return this->current_node == other.current_node;
+        }
+
+        bool operator!=(const ConstIterator &other) const {
+            return !(*this == other);
+        }
+
+    private:
+        node_pointer current_node;
+        const IndexedLinkedList *list;
+
+        void checkIsNotEnd() const {
+            if (*this == list->end()) {
+                throw std::out_of_range("Iterator is out of range");
+            }
+        }
+
+        void checkIsNotBegin() const {
+            if (*this == list->begin()) {
+                throw std::out_of_range("Iterator is out of range");
+            }
+        }
+    };
+
+    template<typename Type, typename Allocator>
+    class IndexedLinkedList<Type, Allocator>::Iterator : public IndexedLinkedList<Type, Allocator>::ConstIterator {
+    public:
+        using pointer = typename IndexedLinkedList::pointer;
+        using reference = typename IndexedLinkedList::reference;
+
+        explicit Iterator(node_pointer current_node, const IndexedLinkedList &list)
+                : ConstIterator(current_node, list) {}
+
+        Iterator(const ConstIterator &other) : ConstIterator(other) {}
+
+        Iterator &operator++() {
+            ConstIterator::operator++();
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            auto result = *this;
+            ConstIterator::operator++();
+            return result;
+        }
+
+        Iterator &operator--() {
+            ConstIterator::operator--();
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            auto result = *this;
+            ConstIterator::operator--();
+            return result;
+        }
+
+        Iterator operator+(difference_type d) const {
+            return ConstIterator::operator+(d);
+        }
+
+        Iterator operator-(difference_type d) const {
+            return ConstIterator::operator-(d);
+        }
+
+        reference operator*() const {
+            // ugly cast, yet reduces code duplication.
+            return const_cast<reference>(ConstIterator::operator*());
+        }
+    };
+
+}
+
+#endif // AISDI_LINEAR_INDEXEDLINKEDLIST_H
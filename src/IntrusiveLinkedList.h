@@ -0,0 +1,428 @@
+#ifndef AISDI_LINEAR_INTRUSIVELINKEDLIST_H
+#define AISDI_LINEAR_INTRUSIVELINKEDLIST_H
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#ifndef AISDI_CHECKED_ITERATORS
+#ifdef NDEBUG
+#define AISDI_CHECKED_ITERATORS 0
+#else
+#define AISDI_CHECKED_ITERATORS 1
+#endif
+#endif
+
+namespace aisdi {
+
+    // Links an object into an IntrusiveLinkedList. Copies start unlinked, so copying the owning
+    // object never copies its position in a list.
+    class IntrusiveListHook {
+    public:
+        IntrusiveListHook() : next(nullptr), prev(nullptr), owner(nullptr) {}
+
+        IntrusiveListHook(const IntrusiveListHook &) : IntrusiveListHook() {}
+
+        IntrusiveListHook &operator=(const IntrusiveListHook &) {
+            return *this;
+        }
+
+        bool isLinked() const {
+            return this->next != nullptr;
+        }
+
+    private:
+        template<typename Type, IntrusiveListHook Type::*Hook>
+        friend class IntrusiveLinkedList;
+
+        IntrusiveListHook *next;
+        IntrusiveListHook *prev;
+        // The list the hook is linked into, so that erasing through another list can be caught. Only
+        // AISDI_CHECKED_ITERATORS builds set it, but it is always there, so that translation units built
+        // either way agree on the layout of every object embedding a hook.
+        const void *owner;
+    };
+
+    // List of objects owned elsewhere, linked through their Hook member. Inserting and erasing never
+    // allocate, and an object is erased in O(1) given just a reference to it. The list does not own
+    // its items: they have to be erased before they are destroyed, and are unlinked when the list is.
+    template<typename Type, IntrusiveListHook Type::*Hook>
+    class IntrusiveLinkedList {
+    private:
+        using difference_type = std::ptrdiff_t;
+        using size_type = std::size_t;
+        using value_type = Type;
+        using pointer = Type *;
+        using reference = Type &;
+        using const_pointer = const Type *;
+        using const_reference = const Type &;
+
+        class ConstIterator;
+
+        class Iterator;
+
+        using const_iterator = ConstIterator;
+        using iterator = Iterator;
+
+        using hook_pointer = IntrusiveListHook *;
+
+        // Circular through the sentinel, as in LinkedList.
+        IntrusiveListHook sentinel;
+        size_type size;
+        // Where Hook sits inside a Type, the same for every item; measured on each item linked in, so that
+        // iterators map a hook back to its item with a subtraction.
+        std::ptrdiff_t hookOffset;
+
+        void checkNotEmpty() {
+            if (this->isEmpty()) {
+                throw std::logic_error("Collection is empty.");
+            }
+        }
+
+        static hook_pointer hookOf(reference item) {
+            return &(item.*Hook);
+        }
+
+        static std::ptrdiff_t offsetOf(reference item) {
+            return reinterpret_cast<char *>(hookOf(item)) - reinterpret_cast<char *>(&item);
+        }
+
+        // Only hooks of linked items are ever passed, so hookOffset has been measured by then.
+        pointer ownerOf(hook_pointer hook) const {
+            return reinterpret_cast<pointer>(reinterpret_cast<char *>(hook) - this->hookOffset);
+        }
+
+        hook_pointer endHook() const {
+            return const_cast<hook_pointer>(&this->sentinel);
+        }
+
+        void resetSentinel() noexcept {
+            this->sentinel.next = this->sentinel.prev = &this->sentinel;
+        }
+
+        void relinkSentinel() noexcept {
+            if (this->size == 0) {
+                this->resetSentinel();
+            } else {
+                this->sentinel.next->prev = &this->sentinel;
+                this->sentinel.prev->next = &this->sentinel;
+            }
+        }
+
+        void unlink(hook_pointer hook) {
+            hook->prev->next = hook->next;
+            hook->next->prev = hook->prev;
+            hook->next = hook->prev = nullptr;
+            setOwner(hook, nullptr);
+        }
+
+        static void setOwner(hook_pointer hook, const IntrusiveLinkedList *owner) {
+#if AISDI_CHECKED_ITERATORS
+            hook->owner = owner;
+#else
+            (void) hook;
+            (void) owner;
+#endif
+        }
+
+        // With AISDI_CHECKED_ITERATORS the items are told their new list, which takes a walk over them.
+        void claimItems() {
+#if AISDI_CHECKED_ITERATORS
+            for (hook_pointer it = this->sentinel.next; it != &this->sentinel; it = it->next) {
+                setOwner(it, this);
+            }
+#endif
+        }
+
+    public:
+        IntrusiveLinkedList() : size(0), hookOffset(0) {
+            this->resetSentinel();
+        }
+
+        IntrusiveLinkedList(const IntrusiveLinkedList &) = delete;
+
+        IntrusiveLinkedList &operator=(const IntrusiveLinkedList &) = delete;
+
+        IntrusiveLinkedList(IntrusiveLinkedList &&other) noexcept : IntrusiveLinkedList() {
+            this->swap(other);
+        }
+
+        IntrusiveLinkedList &operator=(IntrusiveLinkedList &&other) noexcept {
+            if (this != &other) {
+                clear();
+                this->swap(other);
+            }
+            return *this;
+        }
+
+        ~IntrusiveLinkedList() {
+            clear();
+        }
+
+        void swap(IntrusiveLinkedList &other) noexcept {
+            std::swap(this->sentinel.next, other.sentinel.next);
+            std::swap(this->sentinel.prev, other.sentinel.prev);
+            std::swap(this->size, other.size);
+            std::swap(this->hookOffset, other.hookOffset);
+            this->relinkSentinel();
+            other.relinkSentinel();
+            this->claimItems();
+            other.claimItems();
+        }
+
+        bool isEmpty() const {
+            return this->size == 0;
+        }
+
+        size_type getSize() const {
+            return this->size;
+        }
+
+        void append(reference item) {
+            insert(cend(), item);
+        }
+
+        void prepend(reference item) {
+            insert(cbegin(), item);
+        }
+
+        void insert(const const_iterator &insertPosition, reference item) {
+            const hook_pointer hook = hookOf(item);
+            if (hook->isLinked()) {
+                throw std::logic_error("Item is already linked.");
+            }
+
+            const hook_pointer position = insertPosition.current_hook;
+            hook->next = position;
+            hook->prev = position->prev;
+            position->prev->next = hook;
+            position->prev = hook;
+            setOwner(hook, this);
+            this->hookOffset = offsetOf(item);
+            ++this->size;
+        }
+
+        reference popFirst() {
+            this->checkNotEmpty();
+            reference first = *this->begin();
+            erase(first);
+            return first;
+        }
+
+        reference popLast() {
+            this->checkNotEmpty();
+            reference last = *(--this->end());
+            erase(last);
+            return last;
+        }
+
+        void erase(const const_iterator &position) {
+            if (position == end()) {
+                throw std::out_of_range("Iterator is out of range");
+            }
+            unlink(position.current_hook);
+            --this->size;
+        }
+
+        void erase(const const_iterator &firstIncluded, const const_iterator &lastExcluded) {
+            for (auto toErase = firstIncluded; toErase != lastExcluded;) {
+                erase(toErase++);
+            }
+        }
+
+        // Erases an item known to be in this list, without looking for it. With AISDI_CHECKED_ITERATORS
+        // an item of another list is refused.
+        void erase(reference item) {
+            const hook_pointer hook = hookOf(item);
+            if (!hook->isLinked()) {
+                throw std::logic_error("Item is not linked.");
+            }
+#if AISDI_CHECKED_ITERATORS
+            if (hook->owner != this) {
+                throw std::logic_error("Item is linked into another list.");
+            }
+#endif
+            unlink(hook);
+            --this->size;
+        }
+
+        // Unlinks every item, leaving them free to join another list.
+        void clear() {
+            for (hook_pointer it = this->sentinel.next; it != &this->sentinel;) {
+                const hook_pointer next = it->next;
+                it->next = it->prev = nullptr;
+                setOwner(it, nullptr);
+                it = next;
+            }
+            this->resetSentinel();
+            this->size = 0;
+        }
+
+        iterator iteratorTo(reference item) {
+            return iterator(hookOf(item), *this);
+        }
+
+        iterator begin() {
+            return iterator(this->sentinel.next, *this);
+        }
+
+        iterator end() {
+            return iterator(&this->sentinel, *this);
+        }
+
+        const_iterator cbegin() const {
+            return const_iterator(this->sentinel.next, *this);
+        }
+
+        const_iterator cend() const {
+            return const_iterator(this->endHook(), *this);
+        }
+
+        const_iterator begin() const {
+            return this->cbegin();
+        }
+
+        const_iterator end() const {
+            return this->cend();
+        }
+    };
+
+    template<typename Type, IntrusiveListHook Type::*Hook>
+    class IntrusiveLinkedList<Type, Hook>::ConstIterator {
+        friend class IntrusiveLinkedList;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = typename IntrusiveLinkedList::value_type;
+        using difference_type = typename IntrusiveLinkedList::difference_type;
+        using pointer = typename IntrusiveLinkedList::const_pointer;
+        using reference = typename IntrusiveLinkedList::const_reference;
+
+        explicit ConstIterator(hook_pointer current_hook, const IntrusiveLinkedList &list) :
+                current_hook(current_hook), list(&list) {}
+
+        reference operator*() const {
+            checkIsNotEnd();
+            return *list->ownerOf(this->current_hook);
+        }
+
+        pointer operator->() const {
+            return &**this;
+        }
+
+        ConstIterator &operator++() {
+            checkIsNotEnd();
+            this->current_hook = this->current_hook->next;
+            return *this;
+        }
+
+        ConstIterator operator++(int) {
+            const auto current = *this;
+            ++*this;
+            return current;
+        }
+
+        ConstIterator &operator--() {
+            checkIsNotBegin();
+            this->current_hook = this->current_hook->prev;
+            return *this;
+        }
+
+        ConstIterator operator--(int) {
+            const auto current = *this;
+            --*this;
+            return current;
+        }
+
+        ConstIterator operator+(difference_type d) const {
+            auto copy = *this;
+            for (difference_type i = 0; i < d; ++i, ++copy);
+            return copy;
+        }
+
+        ConstIterator operator-(difference_type d) const {
+            auto copy = *this;
+            for (difference_type i = 0; i < d; ++i, --copy);
+            return copy;
+        }
+
+        bool operator==(const ConstIterator &other) const {
+            return this->current_hook == other.current_hook;
+        }
+
+        bool operator!=(const ConstIterator &other) const {
+            return !(*this == other);
+        }
+
+    private:
+        hook_pointer current_hook;
+        const IntrusiveLinkedList *list;
+
+        void checkIsNotEnd() const {
+            if (*this == list->end()) {
+                throw std::out_of_range("Iterator is out of range");
+            }
+        }
+
+        void checkIsNotBegin() const {
+            if (*this == list->begin()) {
+                throw std::out_of_range("Iterator is out of range");
+            }
+        }
+    };
+
+    template<typename Type, IntrusiveListHook Type::*Hook>
+    class IntrusiveLinkedList<Type, Hook>::Iterator : public IntrusiveLinkedList<Type, Hook>::ConstIterator {
+    public:
+        using pointer = typename IntrusiveLinkedList::pointer;
+        using reference = typename IntrusiveLinkedList::reference;
+
+        explicit Iterator(hook_pointer current_hook, const IntrusiveLinkedList &list)
+                : ConstIterator(current_hook, list) {}
+
+        Iterator(const ConstIterator &other) : ConstIterator(other) {}
+
+        Iterator &operator++() {
+            ConstIterator::operator++();
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            auto result = *this;
+            ConstIterator::operator++();
+            return result;
+        }
+
+        Iterator &operator--() {
+            ConstIterator::operator--();
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            auto result = *this;
+            ConstIterator::operator--();
+            return result;
+        }
+
+        Iterator operator+(difference_type d) const {
+            return ConstIterator::operator+(d);
+        }
+
+        Iterator operator-(difference_type d) const {
+            return ConstIterator::operator-(d);
+        }
+
+        reference operator*() const {
+            // ugly cast, yet reduces code duplication.
+            return const_cast<reference>(ConstIterator::operator*());
+        }
+
+        pointer operator->() const {
+            return &**this;
+        }
+    };
+
+}
+
+#endif // AISDI_LINEAR_INTRUSIVELINKEDLIST_H
@@ -1,13 +1,21 @@
 #ifndef AISDI_LINEAR_LINKEDLIST_H
 #define AISDI_LINEAR_LINKEDLIST_H
 
+#include <atomic>
 #include <cstddef>
+#include <functional>
 #include <initializer_list>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace aisdi {
 
-    template<typename Type>
+    template<typename Type, typename Allocator = std::allocator<Type>>
     class LinkedList {
     private:
         using difference_type = std::ptrdiff_t;
@@ -25,22 +33,102 @@ namespace aisdi {
         using const_iterator = ConstIterator;
         using iterator = Iterator;
 
-        struct node {
-            pointer value;
-            struct node *next;
-            struct node *prev;
+        struct node_base {
+            struct node_base *next;
+            struct node_base *prev;
 
-            explicit node(pointer value) : value(value), next(nullptr), prev(nullptr) {}
-            ~node() {
-                delete value;
+            node_base() : next(nullptr), prev(nullptr) {}
+        };
+
+        // The sentinel is a bare node_base embedded in the list; every other node keeps its value inline.
+        struct node : node_base {
+            value_type value;
+
+            template<typename... Args>
+            explicit node(Args &&... args) : node_base(), value(std::forward<Args>(args)...) {}
+        };
+
+        using node_pointer = node_base *;
+
+        using node_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<node>;
+        using node_allocator_traits = std::allocator_traits<node_allocator_type>;
+
+        // Nodes are carved out of slabs allocated in one piece. The first slot of every slab holds its
+        // header, erased nodes go to a free list and are handed out again before a new slab is allocated.
+        struct slab {
+            slab *next;
+            size_type capacity;
+        };
+
+        struct free_slot {
+            free_slot *next;
+        };
+
+        // A list starts out with a pool of its own. Splicing part of a list into another makes the two
+        // share one pool, since their nodes then sit in the same slabs; the slabs are freed with the last
+        // list using them. While more than one list uses a pool it is locked around every change, so
+        // lists sharing it may be used from different threads.
+        struct node_pool {
+            slab *slabs;
+            slab *lastSlab;
+            free_slot *freeSlots;
+            free_slot *lastFreeSlot;
+            size_type freeCount;
+            size_type pooledCount;
+            // How many lists take their nodes from the pool. Only a list using the pool raises it, so a
+            // list reading 1 is alone with the pool until it shares the pool itself.
+            std::atomic<size_type> references;
+            std::mutex mutex;
+
+            node_pool()
+                    : slabs(nullptr), lastSlab(nullptr), freeSlots(nullptr), lastFreeSlot(nullptr), freeCount(0),
+                      pooledCount(0), references(1) {}
+
+            bool isShared() const {
+                return this->references.load(std::memory_order_acquire) > 1;
+            }
+        };
+
+        // Holds the pool's mutex while the pool is shared.
+        class pool_guard {
+        public:
+            explicit pool_guard(node_pool &nodes) : nodes(nodes), locked(nodes.isShared()) {
+                if (this->locked) {
+                    this->nodes.mutex.lock();
+                }
+            }
+
+            pool_guard(const pool_guard &) = delete;
+
+            pool_guard &operator=(const pool_guard &) = delete;
+
+            ~pool_guard() {
+                if (this->locked) {
+                    this->nodes.mutex.unlock();
+                }
             }
+
+        private:
+            node_pool &nodes;
+            const bool locked;
         };
 
-        using node_pointer = node *;
+        using pool_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<node_pool>;
+        using pool_allocator_traits = std::allocator_traits<pool_allocator_type>;
+
+        static constexpr size_type minimalSlabCapacity = 8;
+        static constexpr size_type maximalSlabCapacity = 1024;
 
-        node_pointer root;
-        node_pointer tail;
+        node_allocator_type allocator;
+        node_pool *pool;
+        // The list is circular through the sentinel: sentinel.next is the first node, sentinel.prev the last.
+        node_base sentinel;
         size_type size;
+        // Where the last positional access ended, so that scans by increasing index walk every node once.
+        // fingerNode is null while the position is unknown.
+        // Only non-const access moves it, so const access stays safe to share between threads.
+        node_pointer fingerNode;
+        size_type fingerIndex;
 
         void checkNotEmpty() {
             if (this->isEmpty()) {
@@ -48,39 +136,425 @@ namespace aisdi {
             }
         }
 
+        // Returns the pool the nodes come from, creating it on first use.
+        node_pool &currentPool() {
+            if (this->pool == nullptr) {
+                pool_allocator_type poolAllocator(this->allocator);
+                const auto created = pool_allocator_traits::allocate(poolAllocator, 1);
+                pool_allocator_traits::construct(poolAllocator, created);
+                this->pool = created;
+            }
+            return *this->pool;
+        }
+
+        // The pool has to be held by the caller, as do all functions taking one.
+        static void pushSlots(node_pool &nodes, free_slot *first, free_slot *last, size_type count) {
+            last->next = nodes.freeSlots;
+            nodes.freeSlots = first;
+            if (nodes.lastFreeSlot == nullptr) {
+                nodes.lastFreeSlot = last;
+            }
+            nodes.freeCount += count;
+        }
+
+        void addSlab(node_pool &nodes, size_type capacity) {
+            const auto block = node_allocator_traits::allocate(this->allocator, capacity + 1);
+            nodes.slabs = new(static_cast<void *>(block)) slab{nodes.slabs, capacity + 1};
+            if (nodes.lastSlab == nullptr) {
+                nodes.lastSlab = nodes.slabs;
+            }
+            // chained forwards, so consecutive allocations get consecutive addresses.
+            free_slot *const first = new(static_cast<void *>(block + 1)) free_slot{nullptr};
+            free_slot *last = first;
+            for (size_type i = 2; i <= capacity; ++i) {
+                last = last->next = new(static_cast<void *>(block + i)) free_slot{nullptr};
+            }
+            pushSlots(nodes, first, last, capacity);
+            nodes.pooledCount += capacity;
+        }
+
+        void *allocateSlot() {
+            node_pool &nodes = currentPool();
+            const pool_guard guard(nodes);
+            if (nodes.freeSlots == nullptr) {
+                const size_type capacity = nodes.pooledCount < minimalSlabCapacity ? minimalSlabCapacity :
+                                           nodes.pooledCount > maximalSlabCapacity ? maximalSlabCapacity :
+                                           nodes.pooledCount;
+                addSlab(nodes, capacity);
+            }
+            free_slot *const slot = nodes.freeSlots;
+            nodes.freeSlots = slot->next;
+            if (nodes.freeSlots == nullptr) {
+                nodes.lastFreeSlot = nullptr;
+            }
+            --nodes.freeCount;
+            return slot;
+        }
+
+        void releaseSlot(void *slot) {
+            free_slot *const released = new(slot) free_slot{nullptr};
+            this->releaseSlots(released, released, 1);
+        }
+
+        // Returns a chain of count slots to the pool with one lock.
+        void releaseSlots(free_slot *first, free_slot *last, size_type count) {
+            node_pool &nodes = *this->pool;
+            const pool_guard guard(nodes);
+            pushSlots(nodes, first, last, count);
+        }
+
+        // Drops this list's use of the pool, freeing the slabs if no other list uses it. Every node of
+        // this list has to be back in the pool by then.
+        void releasePool() {
+            if (this->pool == nullptr) {
+                return;
+            }
+            node_pool *const released = this->pool;
+            this->pool = nullptr;
+            if (released->references.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                return;
+            }
+            while (released->slabs != nullptr) {
+                slab *const toDelete = released->slabs;
+                released->slabs = toDelete->next;
+                node_allocator_traits::deallocate(this->allocator, reinterpret_cast<node *>(toDelete),
+                                                  toDelete->capacity);
+            }
+            pool_allocator_type poolAllocator(this->allocator);
+            pool_allocator_traits::destroy(poolAllocator, released);
+            pool_allocator_traits::deallocate(poolAllocator, released, 1);
+        }
+
+        // Moves the slabs and free slots of source, used by no list but the caller, into target.
+        void mergePool(node_pool &source, node_pool &target) {
+            const pool_guard guard(target);
+            if (source.slabs != nullptr) {
+                source.lastSlab->next = target.slabs;
+                target.slabs = source.slabs;
+                if (target.lastSlab == nullptr) {
+                    target.lastSlab = source.lastSlab;
+                }
+            }
+            if (source.freeSlots != nullptr) {
+                pushSlots(target, source.freeSlots, source.lastFreeSlot, source.freeCount);
+            }
+            target.pooledCount += source.pooledCount;
+            source.slabs = nullptr;
+        }
+
+        // Takes over the slabs and free slots of other, whose pool no other list uses and whose nodes all
+        // move to this list; other is left without a pool.
+        void absorbPool(LinkedList &other) {
+            if (this->pool == nullptr) {
+                std::swap(this->pool, other.pool);
+                return;
+            }
+            this->mergePool(*other.pool, *this->pool);
+            other.releasePool();
+        }
+
+        // Makes both lists take their nodes from one pool, so that nodes may move between them. A pool
+        // used by no other list is merged into the other pool; two pools both shared with further lists
+        // cannot be, and false is returned.
+        bool sharePool(LinkedList &other) {
+            if (this->pool == other.pool) {
+                return true;
+            }
+            LinkedList *from = this;
+            LinkedList *into = &other;
+            if (into->pool == nullptr || (from->pool != nullptr && from->pool->isShared())) {
+                std::swap(from, into);
+            }
+            if (from->pool != nullptr) {
+                if (from->pool->isShared()) {
+                    return false;
+                }
+                from->mergePool(*from->pool, *into->pool);
+                from->releasePool();
+            }
+            into->pool->references.fetch_add(1, std::memory_order_acq_rel);
+            from->pool = into->pool;
+            return true;
+        }
+
+        node_pointer endNode() const {
+            return const_cast<node_pointer>(&this->sentinel);
+        }
+
+        void resetSentinel() noexcept {
+            this->sentinel.next = this->sentinel.prev = &this->sentinel;
+        }
+
+        template<typename... Args>
+        node_pointer createNode(Args &&... args) {
+            const auto slot = static_cast<node *>(allocateSlot());
+            try {
+                node_allocator_traits::construct(this->allocator, slot, std::forward<Args>(args)...);
+            } catch (...) {
+                releaseSlot(slot);
+                throw;
+            }
+            return slot;
+        }
+
+        void destroyNode(node_pointer toDelete) {
+            node_allocator_traits::destroy(this->allocator, static_cast<node *>(toDelete));
+            releaseSlot(toDelete);
+        }
+
+        void destroyAll() {
+            if (this->pool != nullptr && this->pool->isShared()) {
+                // the slabs outlive this list, so its nodes go back to the pool.
+                this->destroyNodes(this->sentinel.next, this->endNode());
+            } else if (!std::is_trivially_destructible<value_type>::value) {
+                for (node_pointer it = this->sentinel.next; it != &this->sentinel; it = it->next) {
+                    node_allocator_traits::destroy(this->allocator, static_cast<node *>(it));
+                }
+            }
+            releasePool();
+        }
+
+        // Destroys the unlinked nodes [first, last) and returns them to the pool together; gives their count.
+        size_type destroyNodes(node_pointer first, node_pointer last) {
+            if (first == last) {
+                return 0;
+            }
+            free_slot *head = nullptr;
+            free_slot *tail = nullptr;
+            size_type count = 0;
+            for (node_pointer toDelete = first; toDelete != last; ++count) {
+                const node_pointer next = toDelete->next;
+                node_allocator_traits::destroy(this->allocator, static_cast<node *>(toDelete));
+                free_slot *const slot = new(static_cast<void *>(toDelete)) free_slot{nullptr};
+                if (tail == nullptr) {
+                    head = slot;
+                } else {
+                    tail->next = slot;
+                }
+                tail = slot;
+                toDelete = next;
+            }
+            releaseSlots(head, tail, count);
+            return count;
+        }
+
+        // Exchanges nodes and pools; the first and last nodes are then pointed at their new sentinel.
+        void swapContents(LinkedList &other) noexcept {
+            std::swap(this->pool, other.pool);
+            std::swap(this->sentinel, other.sentinel);
+            std::swap(this->size, other.size);
+            std::swap(this->fingerNode, other.fingerNode);
+            std::swap(this->fingerIndex, other.fingerIndex);
+            this->relinkSentinel();
+            other.relinkSentinel();
+        }
+
+        // Moves the values of [first, last) into fresh nodes before position, erasing them from other.
+        void moveItems(const const_iterator &position, LinkedList &other,
+                       const const_iterator &first, const const_iterator &last) {
+            for (auto it = first; it != last;) {
+                emplace(position, std::move(static_cast<node *>(it.current_node)->value));
+                other.erase(it++);
+            }
+        }
+
+        void splice(const const_iterator &position, LinkedList &other,
+                    const const_iterator &first, const const_iterator &last, size_type count) {
+            if (count == 0) {
+                return;
+            }
+            if (this->allocator != other.allocator) {
+                // nodes cannot change hands between unequal allocators, so the values are moved one by one.
+                moveItems(position, other, first, last);
+                return;
+            }
+            if (count == other.size && !other.pool->isShared()) {
+                // every node of other moves, so its slabs can follow them.
+                absorbPool(other);
+            } else if (!sharePool(other)) {
+                // both pools are shared with further lists, so they cannot be joined.
+                moveItems(position, other, first, last);
+                return;
+            }
+            transferNodes(position.current_node, first.current_node, last.current_node);
+            this->size += count;
+            other.size -= count;
+            this->forgetFinger();
+            other.forgetFinger();
+        }
+
+        void forgetFinger() {
+            this->fingerNode = nullptr;
+        }
+
+        // Walks to index from the nearest of the first node, the last node and the finger, leaving the
+        // finger where it is.
+        node_pointer walkTo(size_type index) const {
+            if (index == this->size) {
+                return this->endNode();
+            }
+            node_pointer it = this->sentinel.next;
+            size_type position = 0;
+            size_type distance = index;
+            if (this->size - 1 - index < distance) {
+                it = this->sentinel.prev;
+                position = this->size - 1;
+                distance = this->size - 1 - index;
+            }
+            if (this->fingerNode != nullptr &&
+                (index > this->fingerIndex ? index - this->fingerIndex : this->fingerIndex - index) < distance) {
+                it = this->fingerNode;
+                position = this->fingerIndex;
+            }
+
+            for (; position < index; ++position) {
+                it = it->next;
+            }
+            for (; position > index; --position) {
+                it = it->prev;
+            }
+            return it;
+        }
+
+        // As walkTo, then leaves the finger at index.
+        node_pointer nodeAt(size_type index) {
+            const node_pointer it = this->walkTo(index);
+            if (index != this->size) {
+                this->fingerNode = it;
+                this->fingerIndex = index;
+            }
+            return it;
+        }
+
+        // Keeps the finger on its index when a node is linked in before it or at either end.
+        void fingerAfterInsert(node_pointer inserted) {
+            if (this->fingerNode == nullptr) {
+                return;
+            }
+            if (inserted->next == this->fingerNode) {
+                this->fingerNode = inserted;
+            } else if (inserted->prev == &this->sentinel) {
+                ++this->fingerIndex;
+            } else if (inserted->next != &this->sentinel) {
+                this->forgetFinger();
+            }
+        }
+
+        void fingerBeforeErase(node_pointer toErase) {
+            if (this->fingerNode == nullptr) {
+                return;
+            }
+            if (toErase == this->fingerNode) {
+                if (toErase->next != &this->sentinel) {
+                    this->fingerNode = toErase->next;
+                } else {
+                    this->forgetFinger();
+                }
+            } else if (toErase->prev == &this->sentinel) {
+                --this->fingerIndex;
+            } else if (toErase->next != &this->sentinel) {
+                this->forgetFinger();
+            }
+        }
+
+        void relinkSentinel() noexcept {
+            if (this->size == 0) {
+                this->resetSentinel();
+            } else {
+                this->sentinel.next->prev = &this->sentinel;
+                this->sentinel.prev->next = &this->sentinel;
+            }
+        }
+
+        // Unlinks [first, last), which must not be empty, and links it back in before position.
+        static void transferNodes(node_pointer position, node_pointer first, node_pointer last) {
+            const node_pointer lastIncluded = last->prev;
+            first->prev->next = last;
+            last->prev = first->prev;
+
+            first->prev = position->prev;
+            lastIncluded->next = position;
+            position->prev->next = first;
+            position->prev = lastIncluded;
+        }
+
+        static const value_type &valueOf(node_pointer it) {
+            return static_cast<node *>(it)->value;
+        }
+
+        // Merges two sorted chains terminated by nullptr into merged, taking from left on ties. If compare
+        // throws, merged still receives every node of both chains, out of order.
+        template<typename Compare>
+        static void mergeChains(node_pointer left, node_pointer right, node_pointer &merged, Compare &compare) {
+            node_pointer *tail = &merged;
+            try {
+                while (left != nullptr && right != nullptr) {
+                    node_pointer &taken = compare(valueOf(right), valueOf(left)) ? right : left;
+                    *tail = taken;
+                    tail = &taken->next;
+                    taken = taken->next;
+                }
+            } catch (...) {
+                *tail = left;
+                for (; *tail != nullptr; tail = &(*tail)->next);
+                *tail = right;
+                throw;
+            }
+            *tail = left != nullptr ? left : right;
+        }
+
+        // Closes the chain starting at first back into a circular list, restoring the prev links.
+        void relinkChain(node_pointer first) {
+            node_pointer prev = &this->sentinel;
+            for (node_pointer it = first; it != nullptr; it = it->next) {
+                prev->next = it;
+                it->prev = prev;
+                prev = it;
+            }
+            prev->next = &this->sentinel;
+            this->sentinel.prev = prev;
+        }
+
+        // Takes over the allocator of the assigned list when the allocator asks for it.
+        template<typename OtherAllocator>
+        void propagateAllocator(OtherAllocator &&other, std::true_type) {
+            this->allocator = std::forward<OtherAllocator>(other);
+        }
+
+        template<typename OtherAllocator>
+        void propagateAllocator(OtherAllocator &&, std::false_type) {}
+
     public:
+        using allocator_type = Allocator;
+
+        LinkedList() : LinkedList(allocator_type()) {}
 
-        LinkedList() : size(0) {
-            this->root = this->tail = new node(nullptr);
+        // An empty list owns no memory; nodes are allocated by the first insertion.
+        explicit LinkedList(const allocator_type &allocator) noexcept
+                : allocator(allocator), pool(nullptr), size(0), fingerNode(nullptr), fingerIndex(0) {
+            this->resetSentinel();
         }
 
-        LinkedList(std::initializer_list<Type> l) : LinkedList() {
+        LinkedList(std::initializer_list<Type> l, const allocator_type &allocator = allocator_type())
+                : LinkedList(allocator) {
             for (const auto &value : l) {
                 append(value);
             }
         }
 
-        LinkedList(const LinkedList &other) : LinkedList() {
+        LinkedList(const LinkedList &other)
+                : LinkedList(node_allocator_traits::select_on_container_copy_construction(other.allocator)) {
             for (const auto &value : other) {
                 append(value);
             }
         }
 
-        LinkedList(LinkedList &&other) : LinkedList() {
-            this->root = other.root;
-            this->tail = other.tail;
-            this->size = other.size;
-            other.root = nullptr;
-            other.tail = nullptr;
+        LinkedList(LinkedList &&other) noexcept : LinkedList(other.allocator) {
+            swapContents(other);
         }
 
         ~LinkedList() {
-            node_pointer next = root;
-            while (next != nullptr) {
-                node_pointer to_delete = next;
-                next = to_delete->next;
-                delete to_delete;
-            }
+            destroyAll();
         }
 
         LinkedList &operator=(const LinkedList &other) {
@@ -88,27 +562,48 @@ namespace aisdi {
                 return *this;
             }
 
-            erase(cbegin(), cend());
+            using propagate = typename node_allocator_traits::propagate_on_container_copy_assignment;
+            clear();
+            if (propagate::value && this->allocator != other.allocator) {
+                releasePool();
+                this->propagateAllocator(other.allocator, propagate());
+            }
             append(other.begin(), other.end());
             return *this;
         }
 
-        LinkedList &operator=(LinkedList &&other) {
+        LinkedList &operator=(LinkedList &&other) noexcept(
+                node_allocator_traits::propagate_on_container_move_assignment::value ||
+                node_allocator_traits::is_always_equal::value) {
             if (this == &other) {
                 return *this;
             }
 
-            erase(cbegin(), cend());
-            root = other.root;
-            tail = other.tail;
-            size = other.size;
+            using propagate = typename node_allocator_traits::propagate_on_container_move_assignment;
+            if (!propagate::value && this->allocator != other.allocator) {
+                // nodes cannot change hands between unequal allocators, so the values are moved one by one.
+                clear();
+                for (auto &value : other) {
+                    append(std::move(value));
+                }
+                return *this;
+            }
 
-            other.root = other.tail = nullptr;
-            other.size = 0;
+            // the nodes live in other's slabs, so the whole pool changes hands.
+            destroyAll();
+            this->size = 0;
+            this->resetSentinel();
+            this->forgetFinger();
+            this->propagateAllocator(std::move(other.allocator), propagate());
+            swapContents(other);
 
             return *this;
         }
 
+        allocator_type getAllocator() const {
+            return allocator_type(this->allocator);
+        }
+
         bool isEmpty() const {
             return this->size == 0;
         }
@@ -117,8 +612,54 @@ namespace aisdi {
             return this->size;
         }
 
+        // Makes room for count elements in total, so that adding them performs no further allocation. The
+        // room is in the pool, so lists sharing it may use it up as well.
+        void reserve(size_type count) {
+            node_pool &nodes = currentPool();
+            const pool_guard guard(nodes);
+            if (count > this->size + nodes.freeCount) {
+                addSlab(nodes, count - this->size - nodes.freeCount);
+            }
+        }
+
+        // Positional access walks from the nearest of the first node, the last node and the node reached by
+        // the previous non-const positional access, so visiting increasing indices through a non-const list
+        // costs amortized O(1) per step. Const access only reads that position, so it is safe to share
+        // between threads.
+        reference at(size_type index) {
+            if (index >= this->size) {
+                throw std::out_of_range("Index is out of range");
+            }
+            return static_cast<node *>(this->nodeAt(index))->value;
+        }
+
+        const_reference at(size_type index) const {
+            if (index >= this->size) {
+                throw std::out_of_range("Index is out of range");
+            }
+            return static_cast<node *>(this->walkTo(index))->value;
+        }
+
+        iterator iteratorAt(size_type index) {
+            if (index > this->size) {
+                throw std::out_of_range("Index is out of range");
+            }
+            return iterator(this->nodeAt(index), *this);
+        }
+
+        const_iterator iteratorAt(size_type index) const {
+            if (index > this->size) {
+                throw std::out_of_range("Index is out of range");
+            }
+            return const_iterator(this->walkTo(index), *this);
+        }
+
         void append(const Type &item) {
-            insert(cend(), item);
+            emplaceAppend(item);
+        }
+
+        void append(Type &&item) {
+            emplaceAppend(std::move(item));
         }
 
         void append(const const_iterator &start, const const_iterator &end) {
@@ -128,37 +669,55 @@ namespace aisdi {
         }
 
         void prepend(const Type &item) {
-            insert(cbegin(), item);
+            emplacePrepend(item);
+        }
+
+        void prepend(Type &&item) {
+            emplacePrepend(std::move(item));
         }
 
         void insert(const const_iterator &insertPosition, const Type &item) {
-            const auto newNode = new node(new value_type(item));
+            emplace(insertPosition, item);
+        }
+
+        void insert(const const_iterator &insertPosition, Type &&item) {
+            emplace(insertPosition, std::move(item));
+        }
+
+        template<typename... Args>
+        void emplaceAppend(Args &&... args) {
+            emplace(cend(), std::forward<Args>(args)...);
+        }
+
+        template<typename... Args>
+        void emplacePrepend(Args &&... args) {
+            emplace(cbegin(), std::forward<Args>(args)...);
+        }
+
+        template<typename... Args>
+        void emplace(const const_iterator &insertPosition, Args &&... args) {
+            const auto newNode = createNode(std::forward<Args>(args)...);
 
             const auto insertPositionNode = insertPosition.current_node;
             newNode->next = insertPositionNode;
             newNode->prev = insertPositionNode->prev;
             newNode->next->prev = newNode;
-
-
-            if (newNode->prev == nullptr) {
-                this->root = newNode;
-            } else {
-                newNode->prev->next = newNode;
-            }
+            newNode->prev->next = newNode;
 
             ++this->size;
+            this->fingerAfterInsert(newNode);
         }
 
         Type popFirst() {
             this->checkNotEmpty();
-            const auto first = *this->begin();
+            auto first = std::move(*this->begin());
             erase(this->begin());
             return first;
         }
 
         Type popLast() {
             this->checkNotEmpty();
-            const auto last = *(--this->end());
+            auto last = std::move(*(--this->end()));
             erase(--this->end());
             return last;
         }
@@ -168,38 +727,172 @@ namespace aisdi {
                 throw std::out_of_range("Iterator is out of range");
             }
             const auto nodeToDelete = position.current_node;
+            this->fingerBeforeErase(nodeToDelete);
 
             nodeToDelete->next->prev = nodeToDelete->prev;
-            if (nodeToDelete == this->root) {
-                this->root = nodeToDelete->next;
-            } else {
-                nodeToDelete->prev->next = nodeToDelete->next;
-            }
+            nodeToDelete->prev->next = nodeToDelete->next;
 
-            delete (nodeToDelete);
+            destroyNode(nodeToDelete);
             --size;
         }
 
+        // Detaches the whole segment with a single relink, then returns its nodes to the pool.
         void erase(const const_iterator &firstIncluded, const const_iterator &lastExcluded) {
-            for (auto toDelete = firstIncluded; toDelete != lastExcluded; ++toDelete) {
-                erase(toDelete);
+            const node_pointer first = firstIncluded.current_node;
+            const node_pointer last = lastExcluded.current_node;
+            if (first == last) {
+                return;
             }
+
+            const bool fromFirst = first->prev == &this->sentinel;
+            first->prev->next = last;
+            last->prev = first->prev;
+
+            size_type fingerOffset = this->size;
+            if (this->fingerNode != nullptr) {
+                size_type offset = 0;
+                for (node_pointer it = first; it != last && fingerOffset == this->size; it = it->next, ++offset) {
+                    if (it == this->fingerNode) {
+                        fingerOffset = offset;
+                    }
+                }
+            }
+            const size_type erased = this->destroyNodes(first, last);
+            this->size -= erased;
+
+            // the finger moves to the node following the segment, or shifts if the segment preceded it.
+            if (this->fingerNode == nullptr) {
+                return;
+            }
+            if (fingerOffset != this->size + erased) {
+                this->fingerNode = last;
+                this->fingerIndex -= fingerOffset;
+                if (last == &this->sentinel) {
+                    this->forgetFinger();
+                }
+            } else if (fromFirst) {
+                this->fingerIndex -= erased;
+            } else if (last != &this->sentinel) {
+                this->forgetFinger();
+            }
+        }
+
+        // Empties the list, keeping its nodes pooled for reuse.
+        void clear() {
+            erase(cbegin(), cend());
+        }
+
+        // Moves all items of other before position by relinking their nodes, which keep their addresses;
+        // iterators to the moved items have to be taken anew from this list. Unless other shares its pool,
+        // other's slabs come along and the lists stay independent.
+        void splice(const const_iterator &position, LinkedList &other) {
+            if (&other == this || other.isEmpty()) {
+                return;
+            }
+            splice(position, other, other.cbegin(), other.cend(), other.size);
+        }
+
+        // As above, for the items [first, last) of other. The relinking is O(1), but counting the items
+        // takes a walk over the range, so the splice is O(k) for k items. Moving part of other ties the
+        // two lists to one pool, freed with the last of them; should both pools already be shared with
+        // further lists, the values are moved into fresh nodes instead. Within one list, a position
+        // inside [first, last] leaves the list as it is.
+        void splice(const const_iterator &position, LinkedList &other,
+                    const const_iterator &first, const const_iterator &last) {
+            size_type count = 0;
+            for (node_pointer it = first.current_node; it != last.current_node; it = it->next) {
+                if (it == position.current_node) {
+                    return;
+                }
+                ++count;
+            }
+            if (&other == this) {
+                if (count != 0 && position != last) {
+                    transferNodes(position.current_node, first.current_node, last.current_node);
+                    this->forgetFinger();
+                }
+                return;
+            }
+            splice(position, other, first, last, count);
+        }
+
+        void concatenate(LinkedList &other) {
+            splice(cend(), other);
+        }
+
+        // Moves the items from position to the end into a new list, in O(k) for k items moved as splice.
+        LinkedList splitAt(const const_iterator &position) {
+            LinkedList rest(getAllocator());
+            rest.splice(rest.cend(), *this, position, cend());
+            return rest;
+        }
+
+        // Stable bottom-up merge sort. Nodes are relinked, never copied or moved, so iterators stay valid
+        // and follow their items. runs[k] holds a sorted run of 2^k nodes, merged upwards as in a binary
+        // counter. If compare throws, the list keeps all its items in an unspecified order.
+        template<typename Compare = std::less<Type>>
+        void sort(Compare compare = Compare()) {
+            if (this->size < 2) {
+                return;
+            }
+            this->forgetFinger();
+            this->sentinel.prev->next = nullptr;
+
+            node_pointer runs[std::numeric_limits<size_type>::digits] = {};
+            size_type usedRuns = 0;
+            node_pointer rest = this->sentinel.next;
+            node_pointer run = nullptr;
+            try {
+                while (rest != nullptr) {
+                    run = rest;
+                    rest = rest->next;
+                    run->next = nullptr;
+                    size_type k = 0;
+                    for (; k < usedRuns && runs[k] != nullptr; ++k) {
+                        const node_pointer earlier = runs[k];
+                        runs[k] = nullptr;
+                        mergeChains(earlier, run, run, compare);
+                    }
+                    if (k == usedRuns) {
+                        ++usedRuns;
+                    }
+                    runs[k] = run;
+                    run = nullptr;
+                }
+                for (size_type k = 0; k < usedRuns; ++k) {
+                    if (runs[k] != nullptr) {
+                        const node_pointer earlier = runs[k];
+                        runs[k] = nullptr;
+                        mergeChains(earlier, run, run, compare);
+                    }
+                }
+            } catch (...) {
+                // every node is in exactly one of run, runs and rest; they are chained back together.
+                node_pointer *tail = &run;
+                for (size_type k = 0; k <= usedRuns; ++k) {
+                    for (; *tail != nullptr; tail = &(*tail)->next);
+                    *tail = k < usedRuns ? runs[k] : rest;
+                }
+                this->relinkChain(run);
+                throw;
+            }
+            this->relinkChain(run);
         }
 
         iterator begin() {
-            return iterator(this->root, *this);
+            return iterator(this->sentinel.next, *this);
         }
 
         iterator end() {
-            return iterator(this->tail, *this);
+            return iterator(&this->sentinel, *this);
         }
 
         const_iterator cbegin() const {
-            return const_iterator(this->root, *this);
+            return const_iterator(this->sentinel.next, *this);
         }
 
         const_iterator cend() const {
-            return const_iterator(this->tail, *this);
+            return const_iterator(this->endNode(), *this);
         }
 
         const_iterator begin() const {
@@ -211,8 +904,8 @@ namespace aisdi {
         }
     };
 
-    template<typename Type>
-    class LinkedList<Type>::ConstIterator {
+    template<typename Type, typename Allocator>
+    class LinkedList<Type, Allocator>::ConstIterator {
         friend class LinkedList;
 
     public:
@@ -222,12 +915,12 @@ namespace aisdi {
         using pointer = typename LinkedList::const_pointer;
         using reference = typename LinkedList::const_reference;
 
-        explicit ConstIterator(node_pointer current_node, const LinkedList<value_type> &list) :
+        explicit ConstIterator(node_pointer current_node, const LinkedList &list) :
                 current_node(current_node), list(list) {}
 
         reference operator*() const {
             checkIsNotEnd();
-            return *(this->current_node->value);
+            return static_cast<node *>(this->current_node)->value;
         }
 
         ConstIterator &operator++() {
@@ -258,13 +951,13 @@ namespace aisdi {
 
         ConstIterator operator+(difference_type d) const {
             auto copy = *this;
-            for (int i = 0; i < d; ++i, ++copy);
+            for (difference_type i = 0; i < d; ++i, ++copy);
             return copy;
         }
 
         ConstIterator operator-(difference_type d) const {
             auto copy = *this;
-            for (int i = 0; i < d; ++i, --copy);
+            for (difference_type i = 0; i < d; ++i, --copy);
             return copy;
         }
 
@@ -278,7 +971,7 @@ namespace aisdi {
 
     private:
         node_pointer current_node;
-        const LinkedList<value_type> &list;
+        const LinkedList &list;
 
         void checkIsNotEnd() const {
             if (*this == list.end()) {
@@ -294,13 +987,13 @@ namespace aisdi {
 
     };
 
-    template<typename Type>
-    class LinkedList<Type>::Iterator : public LinkedList<Type>::ConstIterator {
+    template<typename Type, typename Allocator>
+    class LinkedList<Type, Allocator>::Iterator : public LinkedList<Type, Allocator>::ConstIterator {
     public:
         using pointer = typename LinkedList::pointer;
         using reference = typename LinkedList::reference;
 
-        explicit Iterator(node_pointer current_node, const LinkedList<value_type> &list)
+        explicit Iterator(node_pointer current_node, const LinkedList &list)
                 : ConstIterator(current_node, list) {}
 
         Iterator(const ConstIterator &other) : ConstIterator(other) {}
@@ -341,6 +1034,13 @@ namespace aisdi {
         }
     };
 
+    namespace pmr {
+
+        template<typename Type>
+        using LinkedList = aisdi::LinkedList<Type, std::pmr::polymorphic_allocator<Type>>;
+
+    }
+
 }
 
 #endif // AISDI_LINEAR_LINKEDLIST_H
@@ -0,0 +1,607 @@
+#ifndef AISDI_LINEAR_SEGMENTEDVECTOR_H
+#define AISDI_LINEAR_SEGMENTEDVECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "GrowthPolicy.h"
+#include "Vector.h"
+
+namespace aisdi {
+
+    // The largest power of two of elements fitting in 16 KiB, but at least 16 elements.
+    constexpr std::size_t segmentedVectorBlockSize(std::size_t elementSize) {
+        std::size_t blockSize = 16;
+        while (blockSize * 2 * elementSize <= 16384) {
+            blockSize *= 2;
+        }
+        return blockSize;
+    }
+
+    // Vector made of fixed-size blocks reached through a block index. Growing allocates one more block
+    // and never moves an element, so references and pointers to elements stay valid across appends and
+    // there is no copy stall nor a transient second buffer; only the index of block pointers is
+    // reallocated. Indexing costs a shift and a mask. Inserting and erasing shift the values behind the
+    // position, as in Vector. Iterators, unlike references, are invalidated by any insertion.
+    template<typename Type, std::size_t BlockSize = segmentedVectorBlockSize(sizeof(Type)),
+            typename Allocator = std::allocator<Type>>
+    class SegmentedVector {
+        static_assert(BlockSize != 0 && (BlockSize & (BlockSize - 1)) == 0, "BlockSize has to be a power of two");
+
+    public:
+        using difference_type = std::ptrdiff_t;
+        using size_type = std::size_t;
+        using value_type = Type;
+        using pointer = Type *;
+        using reference = Type &;
+        using const_pointer = const Type *;
+        using const_reference = const Type &;
+        using allocator_type = Allocator;
+
+        class ConstIterator;
+
+        class Iterator;
+
+        using iterator = Iterator;
+        using const_iterator = ConstIterator;
+
+        SegmentedVector() : SegmentedVector(allocator_type()) {}
+
+        // An empty vector owns no block; the first one is allocated by the first insertion.
+        explicit SegmentedVector(const allocator_type &allocator) noexcept
+                : allocator(allocator), blocks(block_allocator_type(allocator)), size(0) {}
+
+        SegmentedVector(std::initializer_list<Type> l, const allocator_type &allocator = allocator_type())
+                : SegmentedVector(allocator) {
+            this->reserve(l.size());
+            for (const auto &value : l) {
+                this->append(value);
+            }
+        }
+
+        SegmentedVector(const SegmentedVector &other)
+                : SegmentedVector(allocator_traits::select_on_container_copy_construction(other.allocator)) {
+            this->copyFrom(other, trivially_copyable());
+        }
+
+        SegmentedVector(SegmentedVector &&other) noexcept : SegmentedVector(other.allocator) {
+            this->swapContents(other);
+        }
+
+        ~SegmentedVector() {
+            this->destroyAll();
+            this->releaseBlocks(0);
+        }
+
+        SegmentedVector &operator=(const SegmentedVector &other) {
+            if (this == &other) {
+                return *this;
+            }
+
+            using propagate = typename allocator_traits::propagate_on_container_copy_assignment;
+            this->destroyAll();
+            if (propagate::value && this->allocator != other.allocator) {
+                this->releaseBlocks(0);
+                this->blocks = block_index(block_allocator_type(other.allocator));
+            }
+            this->propagateAllocator(other.allocator, propagate());
+            this->copyFrom(other, trivially_copyable());
+            return *this;
+        }
+
+        SegmentedVector &operator=(SegmentedVector &&other) noexcept(
+                allocator_traits::propagate_on_container_move_assignment::value ||
+                allocator_traits::is_always_equal::value) {
+            if (this == &other) {
+                return *this;
+            }
+
+            using propagate = typename allocator_traits::propagate_on_container_move_assignment;
+            this->destroyAll();
+            if (!propagate::value && this->allocator != other.allocator) {
+                // the blocks cannot change hands, so the elements are moved one by one.
+                this->reserve(other.size);
+                for (size_type i = 0; i < other.size; ++i) {
+                    this->append(std::move(other[i]));
+                }
+                return *this;
+            }
+            this->releaseBlocks(0);
+            this->propagateAllocator(std::move(other.allocator), propagate());
+            this->swapContents(other);
+            return *this;
+        }
+
+        allocator_type getAllocator() const {
+            return this->allocator;
+        }
+
+        bool isEmpty() const {
+            return this->size == 0;
+        }
+
+        size_type getSize() const {
+            return this->size;
+        }
+
+        size_type getCapacity() const {
+            return this->blocks.getSize() * BlockSize;
+        }
+
+        // Allocates the blocks needed for capacity elements up front.
+        void reserve(size_type capacity) {
+            const size_type blockCount = (capacity + BlockSize - 1) / BlockSize;
+            this->blocks.reserve(blockCount);
+            while (this->blocks.getSize() < blockCount) {
+                this->addBlock();
+            }
+        }
+
+        // Releases the blocks past the last element.
+        void shrinkToFit() {
+            this->releaseBlocks((this->size + BlockSize - 1) / BlockSize);
+            this->blocks.shrinkToFit();
+        }
+
+        reference operator[](size_type index) {
+            return *this->locate(index);
+        }
+
+        const_reference operator[](size_type index) const {
+            return *this->locate(index);
+        }
+
+        reference at(size_type index) {
+            this->checkIndex(index);
+            return *this->locate(index);
+        }
+
+        const_reference at(size_type index) const {
+            this->checkIndex(index);
+            return *this->locate(index);
+        }
+
+        void append(const Type &item) {
+            this->emplaceAppend(item);
+        }
+
+        void append(Type &&item) {
+            this->emplaceAppend(std::move(item));
+        }
+
+        void prepend(const Type &item) {
+            this->emplace(this->cbegin(), item);
+        }
+
+        void prepend(Type &&item) {
+            this->emplace(this->cbegin(), std::move(item));
+        }
+
+        void insert(const const_iterator &insertPosition, const Type &item) {
+            this->emplace(insertPosition, item);
+        }
+
+        void insert(const const_iterator &insertPosition, Type &&item) {
+            this->emplace(insertPosition, std::move(item));
+        }
+
+        // Nothing is ever moved by growth, so args may refer to an element of this vector.
+        template<typename... Args>
+        void emplaceAppend(Args &&... args) {
+            if (this->size == this->getCapacity()) {
+                this->addBlock();
+            }
+            allocator_traits::construct(this->allocator, this->locate(this->size), std::forward<Args>(args)...);
+            ++this->size;
+        }
+
+        template<typename... Args>
+        void emplacePrepend(Args &&... args) {
+            this->emplace(this->cbegin(), std::forward<Args>(args)...);
+        }
+
+        template<typename... Args>
+        void emplace(const const_iterator &position, Args &&... args) {
+            const size_type index = position.index;
+            if (index == this->size) {
+                this->emplaceAppend(std::forward<Args>(args)...);
+                return;
+            }
+
+            value_type item(std::forward<Args>(args)...);
+            this->emplaceAppend(std::move(*this->locate(this->size - 1)));
+            std::move_backward(this->begin() + index, this->end() - 2, this->end() - 1);
+            *this->locate(index) = std::move(item);
+        }
+
+        Type popFirst() {
+            this->checkNotEmpty();
+            value_type first(std::move(*this->locate(0)));
+            this->erase(this->cbegin());
+            return first;
+        }
+
+        // Keeps the emptied block for the next append.
+        Type popLast() {
+            this->checkNotEmpty();
+            value_type last(std::move(*this->locate(this->size - 1)));
+            allocator_traits::destroy(this->allocator, this->locate(this->size - 1));
+            --this->size;
+            return last;
+        }
+
+        void erase(const const_iterator &position) {
+            if (position == cend()) {
+                throw std::out_of_range("Iterator is out of range");
+            }
+            this->erase(position, position + 1);
+        }
+
+        void erase(const const_iterator &firstIncluded, const const_iterator &lastExcluded) {
+            if (firstIncluded == lastExcluded) {
+                return;
+            }
+            const iterator newEnd = std::move(iterator(lastExcluded), this->end(), iterator(firstIncluded));
+            const size_type newSize = newEnd.index;
+            this->destroy(newSize, this->size);
+            this->size = newSize;
+        }
+
+        iterator begin() {
+            return iterator(0, *this);
+        }
+
+        iterator end() {
+            return iterator(this->size, *this);
+        }
+
+        const_iterator cbegin() const {
+            return const_iterator(0, *this);
+        }
+
+        const_iterator cend() const {
+            return const_iterator(this->size, *this);
+        }
+
+        const_iterator begin() const {
+            return cbegin();
+        }
+
+        const_iterator end() const {
+            return cend();
+        }
+
+    private:
+        using allocator_traits = std::allocator_traits<Allocator>;
+        using block_allocator_type = typename allocator_traits::template rebind_alloc<pointer>;
+        using block_index = Vector<pointer, DoublingGrowth, block_allocator_type>;
+        using trivially_copyable = std::integral_constant<bool, std::is_trivially_copyable<value_type>::value>;
+
+        static constexpr size_type blockShift = [] {
+            size_type shift = 0;
+            while ((size_type(1) << shift) < BlockSize) {
+                ++shift;
+            }
+            return shift;
+        }();
+
+        allocator_type allocator;
+        block_index blocks;
+        size_type size;
+
+        // The slot of index, which may lie past the last element but not past the last block.
+        pointer locate(size_type index) const {
+            return this->blocks.data()[index >> blockShift] + (index & (BlockSize - 1));
+        }
+
+        void checkNotEmpty() {
+            if (this->isEmpty()) {
+                throw std::logic_error("Collection is empty.");
+            }
+        }
+
+        void checkIndex(size_type index) const {
+            if (index >= this->size) {
+                throw std::out_of_range("Index is out of range");
+            }
+        }
+
+        void addBlock() {
+            const pointer block = allocator_traits::allocate(this->allocator, BlockSize);
+            try {
+                this->blocks.append(block);
+            } catch (...) {
+                allocator_traits::deallocate(this->allocator, block, BlockSize);
+                throw;
+            }
+        }
+
+        // Deallocates the blocks from the first-th on, which must hold no elements.
+        void releaseBlocks(size_type first) {
+            while (this->blocks.getSize() > first) {
+                allocator_traits::deallocate(this->allocator, this->blocks.popLast(), BlockSize);
+            }
+        }
+
+        // Destroys the elements at indices [first, last).
+        void destroy(size_type first, size_type last) {
+            if (std::is_trivially_destructible<value_type>::value) {
+                return;
+            }
+            for (; first != last; ++first) {
+                allocator_traits::destroy(this->allocator, this->locate(first));
+            }
+        }
+
+        void destroyAll() {
+            this->destroy(0, this->size);
+            this->size = 0;
+        }
+
+        // Trivially copyable elements are copied a block at a time.
+        void copyFrom(const SegmentedVector &other, std::true_type) {
+            this->reserve(other.size);
+            for (size_type copied = 0; copied < other.size; copied += BlockSize) {
+                std::memcpy(static_cast<void *>(this->locate(copied)), other.locate(copied),
+                            std::min(BlockSize, other.size - copied) * sizeof(value_type));
+            }
+            this->size = other.size;
+        }
+
+        void copyFrom(const SegmentedVector &other, std::false_type) {
+            this->reserve(other.size);
+            for (size_type i = 0; i < other.size; ++i) {
+                this->append(other[i]);
+            }
+        }
+
+        void swapContents(SegmentedVector &other) noexcept {
+            std::swap(this->blocks, other.blocks);
+            std::swap(this->size, other.size);
+        }
+
+        template<typename OtherAllocator>
+        void propagateAllocator(OtherAllocator &&other, std::true_type) {
+            this->allocator = std::forward<OtherAllocator>(other);
+        }
+
+        template<typename OtherAllocator>
+        void propagateAllocator(OtherAllocator &&, std::false_type) {}
+    };
+
+    // Iterators keep a pointer to their element besides its index, so stepping within a block is as cheap
+    // as with Vector's; only crossing into the next block goes through the block index. As with Vector's,
+    // only with AISDI_CHECKED_ITERATORS do they throw std::out_of_range when stepped or dereferenced past
+    // the bounds.
+    template<typename Type, std::size_t BlockSize, typename Allocator>
+    class SegmentedVector<Type, BlockSize, Allocator>::ConstIterator {
+        friend class SegmentedVector;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = typename SegmentedVector::value_type;
+        using difference_type = typename SegmentedVector::difference_type;
+        using pointer = typename SegmentedVector::const_pointer;
+        using reference = typename SegmentedVector::const_reference;
+
+        ConstIterator() : index(0), current(nullptr), vector(nullptr) {}
+
+        explicit ConstIterator(size_type index, const SegmentedVector &vector)
+                : index(index), current(nullptr), vector(&vector) {
+            this->reposition();
+        }
+
+        reference operator*() const {
+            this->checkIsNotEnd();
+            return *current;
+        }
+
+        pointer operator->() const {
+            return &**this;
+        }
+
+        reference operator[](difference_type d) const {
+            return *(*this + d);
+        }
+
+        ConstIterator &operator++() {
+            this->checkIsNotEnd();
+            ++this->index;
+            if ((this->index & (BlockSize - 1)) == 0) {
+                this->reposition();
+            } else {
+                ++this->current;
+            }
+            return *this;
+        }
+
+        ConstIterator operator++(int) {
+            const auto result = *this;
+            ++*this;
+            return result;
+        }
+
+        ConstIterator &operator--() {
+            this->checkIsNotBegin();
+            if ((this->index & (BlockSize - 1)) == 0) {
+                --this->index;
+                this->reposition();
+            } else {
+                --this->index;
+                --this->current;
+            }
+            return *this;
+        }
+
+        ConstIterator operator--(int) {
+            const auto result = *this;
+            --*this;
+            return result;
+        }
+
+        ConstIterator &operator+=(difference_type d) {
+            this->index += d;
+            this->reposition();
+            return *this;
+        }
+
+        ConstIterator &operator-=(difference_type d) {
+            this->index -= d;
+            this->reposition();
+            return *this;
+        }
+
+        ConstIterator operator+(difference_type d) const {
+            auto result = *this;
+            result += d;
+            return result;
+        }
+
+        friend ConstIterator operator+(difference_type d, const ConstIterator &it) {
+            return it + d;
+        }
+
+        difference_type operator-(const ConstIterator &other) const {
+            return static_cast<difference_type>(this->index) - static_cast<difference_type>(other.index);
+        }
+
+        ConstIterator operator-(difference_type d) const {
+            auto result = *this;
+            result -= d;
+            return result;
+        }
+
+        bool operator==(const ConstIterator &other) const {
+            return this->index == other.index;
+        }
+
+        bool operator!=(const ConstIterator &other) const {
+            return !(*this == other);
+        }
+
+        bool operator<(const ConstIterator &other) const {
+            return this->index < other.index;
+        }
+
+        bool operator>(const ConstIterator &other) const {
+            return other < *this;
+        }
+
+        bool operator<=(const ConstIterator &other) const {
+            return !(other < *this);
+        }
+
+        bool operator>=(const ConstIterator &other) const {
+            return !(*this < other);
+        }
+
+    private:
+        size_type index;
+        pointer current;
+        const SegmentedVector *vector;
+
+        // Past the last block, as the end of a vector filling all its blocks is, there is no slot to point at.
+        void reposition() {
+            this->current = this->index < vector->getCapacity() ? vector->locate(this->index) : nullptr;
+        }
+
+        void checkIsNotEnd() const {
+#if AISDI_CHECKED_ITERATORS
+            if (this->index >= vector->size) {
+                throw std::out_of_range("Iterator is out of range");
+            }
+#endif
+        }
+
+        void checkIsNotBegin() const {
+#if AISDI_CHECKED_ITERATORS
+            if (this->index == 0) {
+                throw std::out_of_range("Iterator is out of range");
+            }
+#endif
+        }
+    };
+
+    template<typename Type, std::size_t BlockSize, typename Allocator>
+    class SegmentedVector<Type, BlockSize, Allocator>::Iterator
+            : public SegmentedVector<Type, BlockSize, Allocator>::ConstIterator {
+    public:
+        using pointer = typename SegmentedVector::pointer;
+        using reference = typename SegmentedVector::reference;
+
+        Iterator() {}
+
+        explicit Iterator(size_type index, const SegmentedVector &vector) : ConstIterator(index, vector) {}
+
+        Iterator(const ConstIterator &other) : ConstIterator(other) {}
+
+        Iterator &operator++() {
+            ConstIterator::operator++();
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            auto result = *this;
+            ConstIterator::operator++();
+            return result;
+        }
+
+        Iterator &operator--() {
+            ConstIterator::operator--();
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            auto result = *this;
+            ConstIterator::operator--();
+            return result;
+        }
+
+        Iterator &operator+=(difference_type d) {
+            ConstIterator::operator+=(d);
+            return *this;
+        }
+
+        Iterator &operator-=(difference_type d) {
+            ConstIterator::operator-=(d);
+            return *this;
+        }
+
+        Iterator operator+(difference_type d) const {
+            return ConstIterator::operator+(d);
+        }
+
+        friend Iterator operator+(difference_type d, const Iterator &it) {
+            return it + d;
+        }
+
+        Iterator operator-(difference_type d) const {
+            return ConstIterator::operator-(d);
+        }
+
+        using ConstIterator::operator-;
+
+        reference operator*() const {
+            // ugly cast, yet reduces code duplication.
+            return const_cast<reference>(ConstIterator::operator*());
+        }
+
+        pointer operator->() const {
+            return const_cast<pointer>(ConstIterator::operator->());
+        }
+
+        reference operator[](difference_type d) const {
+            return const_cast<reference>(ConstIterator::operator[](d));
+        }
+    };
+
+}
+
+#endif // AISDI_LINEAR_SEGMENTEDVECTOR_H
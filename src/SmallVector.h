@@ -0,0 +1,135 @@
+#ifndef AISDI_LINEAR_SMALLVECTOR_H
+#define AISDI_LINEAR_SMALLVECTOR_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "Vector.h"
+
+namespace aisdi {
+
+    // Vector keeping up to InlineCapacity elements inside the object itself. It allocates only once it
+    // outgrows that buffer. It has Vector's interface and iterators, but is not a Vector: moving out of a
+    // Vector steals its buffer, which for inline elements would outlive the object holding them. Code
+    // taking a const Vector & is given asVector().
+    template<typename Type, std::size_t InlineCapacity, typename GrowthPolicy = OneAndHalfGrowth,
+            typename Allocator = std::allocator<Type>>
+    class SmallVector : private Vector<Type, GrowthPolicy, Allocator> {
+        static_assert(InlineCapacity > 0, "SmallVector needs room for at least one inline element");
+
+        using Base = Vector<Type, GrowthPolicy, Allocator>;
+        using allocator_traits = std::allocator_traits<Allocator>;
+
+    public:
+        using typename Base::difference_type;
+        using typename Base::size_type;
+        using typename Base::value_type;
+        using typename Base::pointer;
+        using typename Base::reference;
+        using typename Base::const_pointer;
+        using typename Base::const_reference;
+        using typename Base::allocator_type;
+        using typename Base::iterator;
+        using typename Base::const_iterator;
+        using typename Base::Iterator;
+        using typename Base::ConstIterator;
+
+        using Base::getAllocator;
+        using Base::isEmpty;
+        using Base::getSize;
+        using Base::getCapacity;
+        using Base::data;
+        using Base::reserve;
+        using Base::append;
+        using Base::prepend;
+        using Base::insert;
+        using Base::emplaceAppend;
+        using Base::emplacePrepend;
+        using Base::emplace;
+        using Base::popFirst;
+        using Base::popLast;
+        using Base::erase;
+        using Base::sort;
+        using Base::stableSort;
+        using Base::radixSort;
+        using Base::begin;
+        using Base::end;
+        using Base::cbegin;
+        using Base::cend;
+
+        SmallVector() : SmallVector(allocator_type()) {}
+
+        // The buffer is a member of this class, so the base is switched to it only once it exists.
+        explicit SmallVector(const allocator_type &allocator) : Base(allocator) {
+            this->adoptInlineStorage(inlineBuffer(), InlineCapacity);
+        }
+
+        SmallVector(std::initializer_list<Type> l, const allocator_type &allocator = allocator_type())
+                : SmallVector(allocator) {
+            this->reserve(l.size());
+            for (const auto &value : l) {
+                this->append(value);
+            }
+        }
+
+        SmallVector(const SmallVector &other)
+                : SmallVector(allocator_traits::select_on_container_copy_construction(other.getAllocator())) {
+            Base::operator=(other);
+        }
+
+        SmallVector(SmallVector &&other) : SmallVector(other.getAllocator()) {
+            this->moveFrom(other);
+            other.resetToInlineStorage();
+        }
+
+        SmallVector &operator=(const SmallVector &other) {
+            Base::operator=(other);
+            return *this;
+        }
+
+        SmallVector &operator=(SmallVector &&other) {
+            if (this == &other) {
+                return *this;
+            }
+
+            this->moveFrom(other);
+            other.resetToInlineStorage();
+            return *this;
+        }
+
+        bool isSmall() const {
+            return this->usesInlineStorage();
+        }
+
+        // Read-only view for code taking a Vector; the elements may sit inline.
+        const Base &asVector() const {
+            return *this;
+        }
+
+        void shrinkToFit() {
+            if (this->getSize() <= InlineCapacity) {
+                this->adoptInlineStorage(inlineBuffer(), InlineCapacity);
+            } else {
+                Base::shrinkToFit();
+            }
+        }
+
+    private:
+        typename std::aligned_storage<sizeof(Type) * InlineCapacity, alignof(Type)>::type buffer;
+
+        pointer inlineBuffer() {
+            return reinterpret_cast<pointer>(&this->buffer);
+        }
+
+        // A moved-from vector gave its heap buffer away; it goes back to the inline one.
+        void resetToInlineStorage() {
+            this->adoptInlineStorage(inlineBuffer(), InlineCapacity);
+        }
+    };
+
+}
+
+#endif // AISDI_LINEAR_SMALLVECTOR_H
@@ -0,0 +1,201 @@
+#ifndef AISDI_LINEAR_SPSCRING_H
+#define AISDI_LINEAR_SPSCRING_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace aisdi {
+
+    // Bounded lock-free FIFO queue between exactly one producer thread and one consumer thread. Storage
+    // for capacity items, rounded up to a power of two, is allocated once, as in Vector; pushing and
+    // popping never allocate.
+    //
+    // head and tail only grow and are masked into the ring. Each side owns one of them and keeps its own
+    // cache line, holding a copy of the other side's index alongside. That copy is refreshed only when
+    // it suggests the ring is full (or empty), so in the steady state neither side reads the other's line.
+    template<typename Type, typename Allocator = std::allocator<Type>>
+    class SpscRing {
+    public:
+        using size_type = std::size_t;
+        using value_type = Type;
+        using pointer = Type *;
+        using reference = Type &;
+        using const_reference = const Type &;
+        using allocator_type = Allocator;
+
+        explicit SpscRing(size_type capacity, const allocator_type &allocator = allocator_type())
+                : allocator(allocator), storage(nullptr), mask(roundCapacity(capacity) - 1),
+                  tail(0), cachedHead(0), head(0), cachedTail(0) {
+            this->storage = allocator_traits::allocate(this->allocator, this->mask + 1);
+        }
+
+        SpscRing(const SpscRing &) = delete;
+
+        SpscRing &operator=(const SpscRing &) = delete;
+
+        // Neither side may use the ring any more.
+        ~SpscRing() {
+            const size_type last = this->tail.load(std::memory_order_acquire);
+            for (size_type i = this->head.load(std::memory_order_acquire); i != last; ++i) {
+                allocator_traits::destroy(this->allocator, this->slot(i));
+            }
+            allocator_traits::deallocate(this->allocator, this->storage, this->mask + 1);
+        }
+
+        allocator_type getAllocator() const {
+            return this->allocator;
+        }
+
+        size_type getCapacity() const {
+            return this->mask + 1;
+        }
+
+        // A snapshot which the other side may invalidate right away.
+        size_type getSize() const {
+            const size_type first = this->head.load(std::memory_order_acquire);
+            return this->tail.load(std::memory_order_acquire) - first;
+        }
+
+        bool isEmpty() const {
+            return this->getSize() == 0;
+        }
+
+        // Producer side. Returns false, leaving item untouched, when the ring is full.
+        bool tryPush(const Type &item) {
+            return this->tryEmplace(item);
+        }
+
+        bool tryPush(Type &&item) {
+            return this->tryEmplace(std::move(item));
+        }
+
+        template<typename... Args>
+        bool tryEmplace(Args &&... args) {
+            const size_type last = this->tail.load(std::memory_order_relaxed);
+            if (this->freeSlots(last) == 0) {
+                return false;
+            }
+            allocator_traits::construct(this->allocator, this->slot(last), std::forward<Args>(args)...);
+            this->tail.store(last + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Producer side. Pushes items from first until the known free room is used up or the range ends,
+        // publishing them with a single store; wrap a range in move iterators to move its items in. Returns
+        // how many were pushed, which may be fewer than the ring has room for when the consumer popped
+        // since the last refresh. Should an item throw, the ones before it are pushed still.
+        template<typename InputIterator>
+        size_type pushBatch(InputIterator first, InputIterator last) {
+            const size_type begin = this->tail.load(std::memory_order_relaxed);
+            const size_type room = this->freeSlots(begin);
+            size_type end = begin;
+            try {
+                for (; end - begin < room && first != last; ++first, ++end) {
+                    allocator_traits::construct(this->allocator, this->slot(end), *first);
+                }
+            } catch (...) {
+                this->tail.store(end, std::memory_order_release);
+                throw;
+            }
+            this->tail.store(end, std::memory_order_release);
+            return end - begin;
+        }
+
+        // Consumer side. Moves the first item into item, or returns false when the ring is empty.
+        bool tryPop(Type &item) {
+            const size_type first = this->head.load(std::memory_order_relaxed);
+            if (this->readySlots(first) == 0) {
+                return false;
+            }
+            item = std::move(*this->slot(first));
+            allocator_traits::destroy(this->allocator, this->slot(first));
+            this->head.store(first + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer side. Pops up to maxCount items into out, releasing their slots with a single store.
+        // Returns how many were popped; fewer than maxCount may also mean items pushed since the last refresh
+        // are left for the next call, and 0 that the ring was found empty. Should writing
+        // an item to out throw, that item stays first in the ring.
+        template<typename OutputIterator>
+        size_type popBatch(OutputIterator out, size_type maxCount) {
+            const size_type begin = this->head.load(std::memory_order_relaxed);
+            const size_type count = std::min(this->readySlots(begin), maxCount);
+            size_type end = begin;
+            try {
+                for (; end - begin < count; ++end) {
+                    *out = std::move(*this->slot(end));
+                    ++out;
+                    allocator_traits::destroy(this->allocator, this->slot(end));
+                }
+            } catch (...) {
+                this->head.store(end, std::memory_order_release);
+                throw;
+            }
+            this->head.store(end, std::memory_order_release);
+            return count;
+        }
+
+    private:
+        using allocator_traits = std::allocator_traits<Allocator>;
+
+        // The producer's and the consumer's indices sit on separate cache lines, so neither side's stores
+        // invalidate the line the other one works on.
+        static constexpr size_type cacheLineSize = 64;
+
+        allocator_type allocator;
+        pointer storage;
+        const size_type mask;
+        // Written by the producer only.
+        alignas(cacheLineSize) std::atomic<size_type> tail;
+        size_type cachedHead;
+        // Written by the consumer only.
+        alignas(cacheLineSize) std::atomic<size_type> head;
+        size_type cachedTail;
+
+        static size_type roundCapacity(size_type capacity) {
+            if (capacity > std::numeric_limits<size_type>::max() / 2 + 1) {
+                throw std::length_error("Collection is too large.");
+            }
+            size_type rounded = 1;
+            while (rounded < capacity) {
+                rounded <<= 1;
+            }
+            return rounded;
+        }
+
+        pointer slot(size_type index) const {
+            return this->storage + (index & this->mask);
+        }
+
+        // How many slots past last are known to be free. head is reread only when the cached copy leaves
+        // no room at all, so a batch takes whatever room is known rather than paying for the consumer's line.
+        size_type freeSlots(size_type last) {
+            size_type room = this->getCapacity() - (last - this->cachedHead);
+            if (room == 0) {
+                this->cachedHead = this->head.load(std::memory_order_acquire);
+                room = this->getCapacity() - (last - this->cachedHead);
+            }
+            return room;
+        }
+
+        // How many items from first are known to be ready; rereads tail only when the cached copy has none.
+        size_type readySlots(size_type first) {
+            size_type ready = this->cachedTail - first;
+            if (ready == 0) {
+                this->cachedTail = this->tail.load(std::memory_order_acquire);
+                ready = this->cachedTail - first;
+            }
+            return ready;
+        }
+    };
+
+}
+
+#endif // AISDI_LINEAR_SPSCRING_H
@@ -0,0 +1,29 @@
+#ifndef AISDI_LINEAR_TYPETRAITS_H
+#define AISDI_LINEAR_TYPETRAITS_H
+
+#include <memory>
+#include <type_traits>
+
+namespace aisdi {
+
+    // A type is trivially relocatable when moving an object to a new address and ending the lifetime of the
+    // source is equivalent to copying its bytes. Containers use this to grow and shift with memcpy/memmove,
+    // skipping per-element move construction and destruction.
+    //
+    // Specialize it as std::true_type for own types that qualify. Types holding pointers into themselves
+    // (e.g. std::string with small string optimization in libstdc++) must not be marked.
+    template<typename Type>
+    struct is_trivially_relocatable : std::is_trivially_copyable<Type> {
+    };
+
+    template<typename Type>
+    struct is_trivially_relocatable<std::unique_ptr<Type>> : std::true_type {
+    };
+
+    template<typename Type>
+    struct is_trivially_relocatable<std::shared_ptr<Type>> : std::true_type {
+    };
+
+}
+
+#endif // AISDI_LINEAR_TYPETRAITS_H
@@ -0,0 +1,660 @@
+#ifndef AISDI_LINEAR_UNROLLEDLINKEDLIST_H
+#define AISDI_LINEAR_UNROLLEDLINKEDLIST_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "TypeTraits.h"
+
+namespace aisdi {
+
+    // Doubly linked list of chunks holding up to ChunkSize elements each, so that a traversal touches
+    // one node per ChunkSize elements while an insertion shifts at most one chunk. A full chunk is split
+    // in two on insertion; a chunk less than half full is merged with the next one when they fit together.
+    // Inserting or erasing invalidates iterators into the chunks involved.
+    template<typename Type, std::size_t ChunkSize = (sizeof(Type) >= 64 ? 8 : 512 / sizeof(Type)),
+            typename Allocator = std::allocator<Type>>
+    class UnrolledLinkedList {
+        static_assert(ChunkSize >= 2, "A chunk has to hold at least two elements");
+
+    private:
+        using difference_type = std::ptrdiff_t;
+        using size_type = std::size_t;
+        using value_type = Type;
+        using pointer = Type *;
+        using reference = Type &;
+        using const_pointer = const Type *;
+        using const_reference = const Type &;
+
+        class ConstIterator;
+
+        class Iterator;
+
+        using const_iterator = ConstIterator;
+        using iterator = Iterator;
+
+        struct node_base {
+            struct node_base *next;
+            struct node_base *prev;
+
+            node_base() : next(nullptr), prev(nullptr) {}
+        };
+
+        struct chunk : node_base {
+            size_type count;
+            typename std::aligned_storage<sizeof(value_type), alignof(value_type)>::type items[ChunkSize];
+
+            chunk() : node_base(), count(0) {}
+
+            pointer at(size_type index) {
+                return reinterpret_cast<pointer>(this->items) + index;
+            }
+        };
+
+        using node_pointer = node_base *;
+
+        using chunk_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<chunk>;
+        using chunk_allocator_traits = std::allocator_traits<chunk_allocator_type>;
+
+        using trivially_relocatable = std::integral_constant<bool, is_trivially_relocatable<value_type>::value>;
+
+        chunk_allocator_type allocator;
+        // Circular through the sentinel, as in LinkedList.
+        node_base sentinel;
+        size_type size;
+
+        void checkNotEmpty() {
+            if (this->isEmpty()) {
+                throw std::logic_error("Collection is empty.");
+            }
+        }
+
+        static chunk *asChunk(node_pointer node) {
+            return static_cast<chunk *>(node);
+        }
+
+        node_pointer endNode() const {
+            return const_cast<node_pointer>(&this->sentinel);
+        }
+
+        void resetSentinel() noexcept {
+            this->sentinel.next = this->sentinel.prev = &this->sentinel;
+        }
+
+        void relinkSentinel() noexcept {
+            if (this->size == 0) {
+                this->resetSentinel();
+            } else {
+                this->sentinel.next->prev = &this->sentinel;
+                this->sentinel.prev->next = &this->sentinel;
+            }
+        }
+
+        // Allocates an empty chunk and links it in before position.
+        chunk *createChunk(node_pointer position) {
+            chunk *const created = chunk_allocator_traits::allocate(this->allocator, 1);
+            new(static_cast<void *>(created)) chunk();
+            created->next = position;
+            created->prev = position->prev;
+            position->prev->next = created;
+            position->prev = created;
+            return created;
+        }
+
+        void removeChunk(chunk *toDelete) {
+            toDelete->prev->next = toDelete->next;
+            toDelete->next->prev = toDelete->prev;
+            chunk_allocator_traits::deallocate(this->allocator, toDelete, 1);
+        }
+
+        void destroy(pointer first, pointer last) {
+            if (std::is_trivially_destructible<value_type>::value) {
+                return;
+            }
+            for (; first != last; ++first) {
+                chunk_allocator_traits::destroy(this->allocator, first);
+            }
+        }
+
+        // Moves count elements into raw memory at destination, leaving raw memory behind. Types whose
+        // move constructor may throw are copied, so the sources stay intact if construction fails.
+        void relocate(pointer source, size_type count, pointer destination, std::true_type) {
+            std::memcpy(static_cast<void *>(destination), source, count * sizeof(value_type));
+        }
+
+        void relocate(pointer source, size_type count, pointer destination, std::false_type) {
+            pointer constructed = destination;
+            try {
+                for (size_type i = 0; i < count; ++i, ++constructed) {
+                    chunk_allocator_traits::construct(this->allocator, constructed, std::move_if_noexcept(source[i]));
+                }
+            } catch (...) {
+                this->destroy(destination, constructed);
+                throw;
+            }
+            this->destroy(source, source + count);
+        }
+
+        // Removes count elements at index, moving the elements behind them left.
+        void closeGap(chunk *target, size_type index, size_type count, std::true_type) {
+            this->destroy(target->at(index), target->at(index + count));
+            std::memmove(static_cast<void *>(target->at(index)), target->at(index + count),
+                         (target->count - index - count) * sizeof(value_type));
+        }
+
+        void closeGap(chunk *target, size_type index, size_type count, std::false_type) {
+            const pointer end = target->at(target->count);
+            const pointer newEnd = std::move(target->at(index + count), end, target->at(index));
+            this->destroy(newEnd, end);
+        }
+
+        // Moves the upper half of a full chunk into a new chunk following it.
+        chunk *split(chunk *full) {
+            const size_type kept = ChunkSize / 2;
+            chunk *const created = createChunk(full->next);
+            try {
+                this->relocate(full->at(kept), ChunkSize - kept, created->at(0), trivially_relocatable());
+            } catch (...) {
+                removeChunk(created);
+                throw;
+            }
+            created->count = ChunkSize - kept;
+            full->count = kept;
+            return created;
+        }
+
+        // Appends the elements of the following chunk when both are small enough, freeing it.
+        void mergeWithNext(chunk *target) {
+            if (target->next == &this->sentinel || target->count >= ChunkSize / 2) {
+                return;
+            }
+            chunk *const next = asChunk(target->next);
+            if (target->count + next->count > ChunkSize) {
+                return;
+            }
+            this->relocate(next->at(0), next->count, target->at(target->count), trivially_relocatable());
+            target->count += next->count;
+            removeChunk(next);
+        }
+
+        // Erases up to count elements of one chunk starting at index and returns the number erased,
+        // moving position to the element that followed them.
+        size_type eraseInChunk(node_pointer &position, size_type &index, size_type count) {
+            chunk *const target = asChunk(position);
+            const size_type erased = std::min(count, target->count - index);
+            this->closeGap(target, index, erased, trivially_relocatable());
+            target->count -= erased;
+            this->size -= erased;
+
+            if (target->count == 0) {
+                position = target->next;
+                index = 0;
+                removeChunk(target);
+                return erased;
+            }
+            this->mergeWithNext(target);
+            if (index == target->count) {
+                position = target->next;
+                index = 0;
+            }
+            return erased;
+        }
+
+        // Finds a chunk with room for an element inserted before position, splitting a full one.
+        void makeRoom(node_pointer &position, size_type &index) {
+            if (position == &this->sentinel) {
+                if (this->sentinel.prev != &this->sentinel && asChunk(this->sentinel.prev)->count < ChunkSize) {
+                    position = this->sentinel.prev;
+                    index = asChunk(position)->count;
+                } else {
+                    position = createChunk(&this->sentinel);
+                    index = 0;
+                }
+                return;
+            }
+
+            chunk *const target = asChunk(position);
+            if (target->count < ChunkSize) {
+                return;
+            }
+            if (index == 0 && target->prev != &this->sentinel && asChunk(target->prev)->count < ChunkSize) {
+                position = target->prev;
+                index = asChunk(position)->count;
+                return;
+            }
+            chunk *const created = split(target);
+            if (index > target->count) {
+                index -= target->count;
+                position = created;
+            }
+        }
+
+        void destroyAll() noexcept {
+            for (node_pointer it = this->sentinel.next; it != &this->sentinel;) {
+                chunk *const toDelete = asChunk(it);
+                it = it->next;
+                this->destroy(toDelete->at(0), toDelete->at(toDelete->count));
+                chunk_allocator_traits::deallocate(this->allocator, toDelete, 1);
+            }
+            this->resetSentinel();
+            this->size = 0;
+        }
+
+        void swapContents(UnrolledLinkedList &other) noexcept {
+            std::swap(this->sentinel, other.sentinel);
+            std::swap(this->size, other.size);
+            this->relinkSentinel();
+            other.relinkSentinel();
+        }
+
+        template<typename OtherAllocator>
+        void propagateAllocator(OtherAllocator &&other, std::true_type) {
+            this->allocator = std::forward<OtherAllocator>(other);
+        }
+
+        template<typename OtherAllocator>
+        void propagateAllocator(OtherAllocator &&, std::false_type) {}
+
+    public:
+        using allocator_type = Allocator;
+
+        UnrolledLinkedList() : UnrolledLinkedList(allocator_type()) {}
+
+        explicit UnrolledLinkedList(const allocator_type &allocator) noexcept : allocator(allocator), size(0) {
+            this->resetSentinel();
+        }
+
+        UnrolledLinkedList(std::initializer_list<Type> l, const allocator_type &allocator = allocator_type())
+                : UnrolledLinkedList(allocator) {
+            for (const auto &value : l) {
+                append(value);
+            }
+        }
+
+        UnrolledLinkedList(const UnrolledLinkedList &other)
+                : UnrolledLinkedList(chunk_allocator_traits::select_on_container_copy_construction(other.allocator)) {
+            append(other.begin(), other.end());
+        }
+
+        UnrolledLinkedList(UnrolledLinkedList &&other) noexcept : UnrolledLinkedList(other.allocator) {
+            swapContents(other);
+        }
+
+        ~UnrolledLinkedList() {
+            destroyAll();
+        }
+
+        UnrolledLinkedList &operator=(const UnrolledLinkedList &other) {
+            if (this == &other) {
+                return *this;
+            }
+
+            using propagate = typename chunk_allocator_traits::propagate_on_container_copy_assignment;
+            clear();
+            this->propagateAllocator(other.allocator, propagate());
+            append(other.begin(), other.end());
+            return *this;
+        }
+
+        UnrolledLinkedList &operator=(UnrolledLinkedList &&other) noexcept(
+                chunk_allocator_traits::propagate_on_container_move_assignment::value ||
+                chunk_allocator_traits::is_always_equal::value) {
+            if (this == &other) {
+                return *this;
+            }
+
+            using propagate = typename chunk_allocator_traits::propagate_on_container_move_assignment;
+            clear();
+            if (!propagate::value && this->allocator != other.allocator) {
+                // chunks cannot change hands between unequal allocators, so the values are moved one by one.
+                for (auto &value : other) {
+                    append(std::move(value));
+                }
+                return *this;
+            }
+            this->propagateAllocator(std::move(other.allocator), propagate());
+            swapContents(other);
+            return *this;
+        }
+
+        allocator_type getAllocator() const {
+            return allocator_type(this->allocator);
+        }
+
+        bool isEmpty() const {
+            return this->size == 0;
+        }
+
+        size_type getSize() const {
+            return this->size;
+        }
+
+        void append(const Type &item) {
+            emplaceAppend(item);
+        }
+
+        void append(Type &&item) {
+            emplaceAppend(std::move(item));
+        }
+
+        void append(const const_iterator &start, const const_iterator &end) {
+            for (auto it = start; it != end; ++it) {
+                append(*it);
+            }
+        }
+
+        void prepend(const Type &item) {
+            emplacePrepend(item);
+        }
+
+        void prepend(Type &&item) {
+            emplacePrepend(std::move(item));
+        }
+
+        void insert(const const_iterator &insertPosition, const Type &item) {
+            emplace(insertPosition, item);
+        }
+
+        void insert(const const_iterator &insertPosition, Type &&item) {
+            emplace(insertPosition, std::move(item));
+        }
+
+        template<typename... Args>
+        void emplaceAppend(Args &&... args) {
+            emplace(cend(), std::forward<Args>(args)...);
+        }
+
+        template<typename... Args>
+        void emplacePrepend(Args &&... args) {
+            emplace(cbegin(), std::forward<Args>(args)...);
+        }
+
+        template<typename... Args>
+        void emplace(const const_iterator &insertPosition, Args &&... args) {
+            node_pointer position = insertPosition.current_node;
+            size_type index = insertPosition.index;
+            if (position == &this->sentinel) {
+                makeRoom(position, index);
+                insertAtEnd(asChunk(position), std::forward<Args>(args)...);
+                return;
+            }
+
+            // args may refer to an element about to be shifted, so the item is built first.
+            value_type item(std::forward<Args>(args)...);
+            makeRoom(position, index);
+            chunk *const target = asChunk(position);
+            if (index == target->count) {
+                insertAtEnd(target, std::move(item));
+            } else {
+                insertMoved(target, index, std::move(item), trivially_relocatable());
+            }
+        }
+
+        Type popFirst() {
+            this->checkNotEmpty();
+            auto first = std::move(*this->begin());
+            erase(this->begin());
+            return first;
+        }
+
+        Type popLast() {
+            this->checkNotEmpty();
+            auto last = std::move(*(--this->end()));
+            erase(--this->end());
+            return last;
+        }
+
+        void erase(const const_iterator &position) {
+            if (position == end()) {
+                throw std::out_of_range("Iterator is out of range");
+            }
+            node_pointer node = position.current_node;
+            size_type index = position.index;
+            eraseInChunk(node, index, 1);
+        }
+
+        // Erases whole runs of each chunk at once.
+        void erase(const const_iterator &firstIncluded, const const_iterator &lastExcluded) {
+            size_type count = 0;
+            for (auto it = firstIncluded; it != lastExcluded; ++it) {
+                ++count;
+            }
+
+            node_pointer node = firstIncluded.current_node;
+            size_type index = firstIncluded.index;
+            while (count != 0) {
+                count -= eraseInChunk(node, index, count);
+            }
+        }
+
+        void clear() {
+            destroyAll();
+        }
+
+        iterator begin() {
+            return iterator(this->sentinel.next, 0, *this);
+        }
+
+        iterator end() {
+            return iterator(&this->sentinel, 0, *this);
+        }
+
+        const_iterator cbegin() const {
+            return const_iterator(this->sentinel.next, 0, *this);
+        }
+
+        const_iterator cend() const {
+            return const_iterator(this->endNode(), 0, *this);
+        }
+
+        const_iterator begin() const {
+            return this->cbegin();
+        }
+
+        const_iterator end() const {
+            return this->cend();
+        }
+
+    private:
+        // Constructs the element past the last one of a chunk with spare room.
+        template<typename... Args>
+        void insertAtEnd(chunk *target, Args &&... args) {
+            try {
+                chunk_allocator_traits::construct(this->allocator, target->at(target->count),
+                                                  std::forward<Args>(args)...);
+            } catch (...) {
+                if (target->count == 0) {
+                    removeChunk(target);
+                }
+                throw;
+            }
+            ++target->count;
+            ++this->size;
+        }
+
+        // Places item at slot index of a chunk with spare room, moving the elements behind it right.
+        void insertMoved(chunk *target, size_type index, value_type &&item, std::true_type) {
+            const size_type count = target->count - index;
+            std::memmove(static_cast<void *>(target->at(index + 1)), target->at(index), count * sizeof(value_type));
+            try {
+                chunk_allocator_traits::construct(this->allocator, target->at(index), std::move(item));
+            } catch (...) {
+                std::memmove(static_cast<void *>(target->at(index)), target->at(index + 1), count * sizeof(value_type));
+                throw;
+            }
+            ++target->count;
+            ++this->size;
+        }
+
+        void insertMoved(chunk *target, size_type index, value_type &&item, std::false_type) {
+            const pointer last = target->at(target->count);
+            chunk_allocator_traits::construct(this->allocator, last, std::move(*(last - 1)));
+            ++target->count;
+            ++this->size;
+            std::move_backward(target->at(index), last - 1, last);
+            *target->at(index) = std::move(item);
+        }
+    };
+
+    template<typename Type, std::size_t ChunkSize, typename Allocator>
+    class UnrolledLinkedList<Type, ChunkSize, Allocator>::ConstIterator {
+        friend class UnrolledLinkedList;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = typename UnrolledLinkedList::value_type;
+        using difference_type = typename UnrolledLinkedList::difference_type;
+        using pointer = typename UnrolledLinkedList::const_pointer;
+        using reference = typename UnrolledLinkedList::const_reference;
+
+        explicit ConstIterator(node_pointer current_node, size_type index, const UnrolledLinkedList &list) :
+                current_node(current_node), index(index), list(&list) {}
+
+        reference operator*() const {
+            checkIsNotEnd();
+            return *asChunk(this->current_node)->at(this->index);
+        }
+
+        ConstIterator &operator++() {
+            checkIsNotEnd();
+            if (++this->index == asChunk(this->current_node)->count) {
+                this->current_node = this->current_node->next;
+                this->index = 0;
+            }
+            return *this;
+        }
+
+        ConstIterator operator++(int) {
+            const auto current = *this;
+            ++*this;
+            return current;
+        }
+
+        ConstIterator &operator--() {
+            checkIsNotBegin();
+            if (this->index == 0) {
+                this->current_node = this->current_node->prev;
+                this->index = asChunk(this->current_node)->count;
+            }
+            --this->index;
+            return *this;
+        }
+
+        ConstIterator operator--(int) {
+            const auto current = *this;
+            --*this;
+            return current;
+        }
+
+        // Skips whole chunks where it can.
+        ConstIterator operator+(difference_type d) const {
+            if (d < 0) {
+                return *this - (-d);
+            }
+            auto copy = *this;
+            size_type remaining = static_cast<size_type>(d);
+            while (remaining != 0) {
+                copy.checkIsNotEnd();
+                const size_type left = asChunk(copy.current_node)->count - copy.index;
+                if (remaining < left) {
+                    copy.index += remaining;
+                    break;
+                }
+                remaining -= left;
+                copy.current_node = copy.current_node->next;
+                copy.index = 0;
+            }
+            return copy;
+        }
+
+        ConstIterator operator-(difference_type d) const {
+            auto copy = *this;
+            for (difference_type i = 0; i < d; ++i, --copy);
+            return copy;
+        }
+
+        bool operator==(const ConstIterator &other) const {
+            return this->current_node == other.current_node && this->index == other.index;
+        }
+
+        bool operator!=(const ConstIterator &other) const {
+            return !(*this == other);
+        }
+
+    private:
+        node_pointer current_node;
+        size_type index;
+        const UnrolledLinkedList *list;
+
+        void checkIsNotEnd() const {
+            if (*this == list->end()) {
+                throw std::out_of_range("Iterator is out of range");
+            }
+        }
+
+        void checkIsNotBegin() const {
+            if (*this == list->begin()) {
+                throw std::out_of_range("Iterator is out of range");
+            }
+        }
+    };
+
+    template<typename Type, std::size_t ChunkSize, typename Allocator>
+    class UnrolledLinkedList<Type, ChunkSize, Allocator>::Iterator
+            : public UnrolledLinkedList<Type, ChunkSize, Allocator>::ConstIterator {
+    public:
+        using pointer = typename UnrolledLinkedList::pointer;
+        using reference = typename UnrolledLinkedList::reference;
+
+        explicit Iterator(node_pointer current_node, size_type index, const UnrolledLinkedList &list)
+                : ConstIterator(current_node, index, list) {}
+
+        Iterator(const ConstIterator &other) : ConstIterator(other) {}
+
+        Iterator &operator++() {
+            ConstIterator::operator++();
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            auto result = *this;
+            ConstIterator::operator++();
+            return result;
+        }
+
+        Iterator &operator--() {
+            ConstIterator::operator--();
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            auto result = *this;
+            ConstIterator::operator--();
+            return result;
+        }
+
+        Iterator operator+(difference_type d) const {
+            return ConstIterator::operator+(d);
+        }
+
+        Iterator operator-(difference_type d) const {
+            return ConstIterator::operator-(d);
+        }
+
+        reference operator*() const {
+            // ugly cast, yet reduces code duplication.
+            return const_cast<reference>(ConstIterator::operator*());
+        }
+    };
+
+}
+
+#endif // AISDI_LINEAR_UNROLLEDLINKEDLIST_H
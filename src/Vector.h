@@ -1,13 +1,35 @@
 #ifndef AISDI_LINEAR_VECTOR_H
 #define AISDI_LINEAR_VECTOR_H
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <utility>
 #include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
+#include <type_traits>
+
+#include "GrowthPolicy.h"
+#include "TypeTraits.h"
+
+#ifndef AISDI_CHECKED_ITERATORS
+#ifdef NDEBUG
+#define AISDI_CHECKED_ITERATORS 0
+#else
+#define AISDI_CHECKED_ITERATORS 1
+#endif
+#endif
 
 namespace aisdi {
 
-    template<typename Type>
+    template<typename Type, typename GrowthPolicy = OneAndHalfGrowth, typename Allocator = std::allocator<Type>>
     class Vector {
     public:
         using difference_type = std::ptrdiff_t;
@@ -17,6 +39,7 @@ namespace aisdi {
         using reference = Type &;
         using const_pointer = const Type *;
         using const_reference = const Type &;
+        using allocator_type = Allocator;
 
         class ConstIterator;
 
@@ -25,39 +48,43 @@ namespace aisdi {
         using iterator = Iterator;
         using const_iterator = ConstIterator;
 
-        Vector() {
-            this->reserved_size = 4;
-            this->size = 0;
-            this->storage = new value_type[this->reserved_size];
-        }
+        Vector() : Vector(allocator_type()) {}
 
-        Vector(std::initializer_list<Type> l) {
+        // An empty vector owns no buffer; the first one is allocated by the first insertion.
+        explicit Vector(const allocator_type &allocator) noexcept
+                : allocator(allocator), inlineStorage(false), storage(nullptr), size(0), reserved_size(0) {}
+
+        Vector(std::initializer_list<Type> l, const allocator_type &allocator = allocator_type())
+                : allocator(allocator), inlineStorage(false) {
             this->size = 0;
             this->reserved_size = l.size();
-            this->storage = new value_type[this->reserved_size];
-            for (const auto &value: l) {
-                this->storage[this->size++] = value;
-            }
+            this->storage = this->allocate(this->reserved_size);
+            this->copyConstruct(l.begin(), l.end());
         }
 
-        Vector(const Vector &other) {
-            this->size = other.size;
+        Vector(const Vector &other)
+                : allocator(allocator_traits::select_on_container_copy_construction(other.allocator)),
+                  inlineStorage(false) {
+            this->size = 0;
             this->reserved_size = other.size;
-            this->storage = new value_type[this->reserved_size];
-            std::copy(other.begin(), other.end(), this->storage);
+            this->storage = this->allocate(this->reserved_size);
+            this->copyConstruct(other.storage, other.storage + other.size);
         }
 
-        Vector(Vector &&other) {
+        // Takes the buffer over. Only SmallVector keeps elements inline, and it derives privately, so that
+        // no SmallVector reaches this noexcept move, which could not allocate a buffer for them.
+        Vector(Vector &&other) noexcept : allocator(std::move(other.allocator)), inlineStorage(false) {
             this->storage = other.storage;
-            other.storage = nullptr;
             this->size = other.size;
             this->reserved_size = other.reserved_size;
+            other.storage = nullptr;
+            other.size = 0;
+            other.reserved_size = 0;
         }
 
         ~Vector() {
-            if (this->storage) {
-                delete[] this->storage;
-            }
+            this->destroy(this->storage, this->storage + this->size);
+            this->replaceStorage(nullptr, 0);
         }
 
         Vector &operator=(const Vector &other) {
@@ -65,28 +92,52 @@ namespace aisdi {
                 return *this;
             }
 
-            delete[] this->storage;
-            this->storage = new Type[other.reserved_size];
-            this->size = other.size;
-            this->reserved_size = other.reserved_size;
-            std::copy(other.cbegin(), other.cend(), begin());
+            using propagate = typename allocator_traits::propagate_on_container_copy_assignment;
+            this->destroy(this->storage, this->storage + this->size);
+            this->size = 0;
+            if (this->reserved_size < other.size || (propagate::value && this->allocator != other.allocator)) {
+                this->replaceStorage(nullptr, 0);
+            }
+            this->propagateAllocator(other.allocator, propagate());
+            if (this->reserved_size < other.size) {
+                this->storage = this->allocate(other.size);
+                this->reserved_size = other.size;
+            }
+            this->copyConstruct(other.storage, other.storage + other.size);
 
             return *this;
         }
 
-        Vector &operator=(Vector &&other) {
+        // Elements held by an unequal allocator are moved one by one, which is the case the noexcept
+        // condition rules out.
+        Vector &operator=(Vector &&other) noexcept(
+                allocator_traits::propagate_on_container_move_assignment::value ||
+                allocator_traits::is_always_equal::value) {
             if (this == &other) {
                 return *this;
             }
 
-            delete[] this->storage;
-            this->storage = other.storage;
-            other.storage = nullptr;
-            this->reserved_size = other.reserved_size;
+            using propagate = typename allocator_traits::propagate_on_container_move_assignment;
+            this->destroy(this->storage, this->storage + this->size);
+            this->size = 0;
+            if (!propagate::value && this->allocator != other.allocator) {
+                // the buffer cannot change hands, so the elements are moved one by one.
+                this->takeElements(other);
+                return *this;
+            }
+            this->replaceStorage(other.storage, other.reserved_size);
+            this->propagateAllocator(std::move(other.allocator), propagate());
             this->size = other.size;
+            other.storage = nullptr;
+            other.size = 0;
+            other.reserved_size = 0;
             return *this;
         }
 
+        allocator_type getAllocator() const {
+            return this->allocator;
+        }
+
         bool isEmpty() const {
             return this->getSize() == 0;
         }
@@ -95,49 +146,253 @@ namespace aisdi {
             return this->size;
         }
 
+        size_type getCapacity() const {
+            return this->reserved_size;
+        }
+
+        // The elements in one contiguous block, for code reading them in bulk.
+        pointer data() {
+            return this->storage;
+        }
+
+        const_pointer data() const {
+            return this->storage;
+        }
+
+        void reserve(size_type capacity) {
+            if (capacity > this->reserved_size) {
+                this->changeCapacity(capacity);
+            }
+        }
+
+        void shrinkToFit() {
+            if (this->reserved_size > this->size) {
+                this->changeCapacity(this->size);
+            }
+        }
+
         void append(const Type &item) {
-            this->insert(this->cend(), item);
+            this->emplaceAppend(item);
+        }
+
+        void append(Type &&item) {
+            this->emplaceAppend(std::move(item));
         }
 
         void prepend(const Type &item) {
-            this->insert(this->cbegin(), item);
+            this->emplacePrepend(item);
+        }
+
+        void prepend(Type &&item) {
+            this->emplacePrepend(std::move(item));
         }
 
         void insert(const const_iterator &insertPosition, const Type &item) {
-            difference_type dst =  insertPosition - cbegin();
+            this->emplace(insertPosition, item);
+        }
+
+        void insert(const const_iterator &insertPosition, Type &&item) {
+            this->emplace(insertPosition, std::move(item));
+        }
+
+        // Inserts [first, last) before insertPosition, growing at most once and shifting the tail once.
+        // The range must not point into this vector.
+        template<typename InputIterator,
+                typename = typename std::iterator_traits<InputIterator>::iterator_category>
+        void insert(const const_iterator &insertPosition, InputIterator first, InputIterator last) {
+            using category = typename std::iterator_traits<InputIterator>::iterator_category;
+            this->insertRange(static_cast<size_type>(insertPosition - cbegin()), first, last, category());
+        }
+
+        void insert(const const_iterator &insertPosition, std::initializer_list<Type> l) {
+            this->insert(insertPosition, l.begin(), l.end());
+        }
+
+        template<typename InputIterator,
+                typename = typename std::iterator_traits<InputIterator>::iterator_category>
+        void append(InputIterator first, InputIterator last) {
+            this->insert(this->cend(), first, last);
+        }
+
+        void append(std::initializer_list<Type> l) {
+            this->insert(this->cend(), l);
+        }
+
+        template<typename... Args>
+        void emplaceAppend(Args &&... args) {
+            this->emplace(this->cend(), std::forward<Args>(args)...);
+        }
+
+        template<typename... Args>
+        void emplacePrepend(Args &&... args) {
+            this->emplace(this->cbegin(), std::forward<Args>(args)...);
+        }
+
+        template<typename... Args>
+        void emplace(const const_iterator &position, Args &&... args) {
+            const size_type dst = static_cast<size_type>(position - cbegin());
             if (this->size == this->reserved_size) {
-                reallocate();
+                // args may refer to the current buffer, so the item is constructed before the buffer is released.
+                reallocate(dst, std::forward<Args>(args)...);
+                return;
             }
-            for (pointer it = this->storage + this->size - 1; it >= this->storage + dst; --it) {
-                *(it + 1) = *it;
+            if (dst == this->size) {
+                allocator_traits::construct(this->allocator, this->storage + this->size, std::forward<Args>(args)...);
+                ++this->size;
+                return;
             }
+
+            value_type item(std::forward<Args>(args)...);
+            this->insertMoved(this->storage + dst, std::move(item), trivially_relocatable());
             ++this->size;
-            *(begin() + dst) = item;
         }
 
         Type popFirst() {
             this->checkNotEmpty();
-            const auto first = this->storage[0];
-            std::copy(++this->begin(), this->end(), this->begin());
-            --this->size;
+            value_type first(std::move(this->storage[0]));
+            this->erase(this->cbegin());
             return first;
         }
 
         Type popLast() {
             this->checkNotEmpty();
+            value_type last(std::move(this->storage[this->size - 1]));
+            this->destroy(this->storage + this->size - 1, this->storage + this->size);
             --this->size;
-            const auto last = this->storage[this->size];
             return last;
         }
 
         void erase(const const_iterator &position) {
-            std::copy(position + 1, cend(), iterator(position));
+            if (position == cend()) {
+                throw std::out_of_range("Iterator is out of range");
+            }
+            const pointer first = this->storage + (position - cbegin());
+            this->shiftLeft(first, first + 1, trivially_relocatable());
             --this->size;
         }
 
         void erase(const const_iterator &firstIncluded, const const_iterator &lastExcluded) {
-            std::copy(lastExcluded, cend(), iterator(firstIncluded));
-            this->size -= lastExcluded - firstIncluded;
+            if (firstIncluded == lastExcluded) {
+                return;
+            }
+            const pointer first = this->storage + (firstIncluded - cbegin());
+            const pointer last = this->storage + (lastExcluded - cbegin());
+            this->shiftLeft(first, last, trivially_relocatable());
+            this->size -= last - first;
+        }
+
+        // Introsort on the raw buffer: quicksort around a median of three, falling back to heapsort when
+        // the recursion goes too deep and to insertion sort on short ranges. Not stable.
+        template<typename Compare = std::less<Type>>
+        void sort(Compare compare = Compare()) {
+            size_type depthLimit = 0;
+            for (size_type n = this->size; n > 1; n /= 2) {
+                depthLimit += 2;
+            }
+            introsort(this->storage, this->storage + this->size, depthLimit, compare);
+        }
+
+        // Bottom-up merge sort keeping equal elements in order. Runs are insertion sorted first, then merged
+        // through a scratch buffer of half the elements, allocated for the call.
+        template<typename Compare = std::less<Type>>
+        void stableSort(Compare compare = Compare()) {
+            if (this->size <= insertionSortCutoff) {
+                insertionSort(this->storage, this->storage + this->size, compare);
+                return;
+            }
+
+            const size_type scratchSize = this->size / 2;
+            const pointer scratch = allocator_traits::allocate(this->allocator, scratchSize);
+            try {
+                const pointer last = this->storage + this->size;
+                for (pointer first = this->storage; first < last; first += insertionSortCutoff) {
+                    insertionSort(first, first + std::min<size_type>(insertionSortCutoff, last - first), compare);
+                }
+                for (size_type width = insertionSortCutoff; width < this->size; width *= 2) {
+                    for (pointer first = this->storage; last - first > static_cast<difference_type>(width);
+                         first += std::min<size_type>(2 * width, last - first)) {
+                        const pointer middle = first + width;
+                        mergeRuns(first, middle, first + std::min<size_type>(2 * width, last - first), scratch,
+                                  compare);
+                    }
+                }
+            } catch (...) {
+                allocator_traits::deallocate(this->allocator, scratch, scratchSize);
+                throw;
+            }
+            allocator_traits::deallocate(this->allocator, scratch, scratchSize);
+        }
+
+        // LSD radix sort on the bytes of an integral or floating point key, for trivially copyable elements.
+        // One pass counts every digit, then each byte on which the keys differ takes one stable scatter
+        // into scratch. Vectors of up to smallSortLimit elements go through a sorting network instead.
+        // Floats order as -NaN < -inf < ... < -0 < +0 < ... < +inf < +NaN. The radix passes are stable,
+        // so longer vectors keep records with equal keys in order; the network is not, so vectors of up
+        // to smallSortLimit elements may not.
+        void radixSort() {
+            Vector scratch(this->allocator);
+            this->radixSort(scratch);
+        }
+
+        // As above, reusing the buffer of scratch across calls; scratch is left empty.
+        void radixSort(Vector &scratch) {
+            this->radixSort(scratch, [](const_reference item) -> const_reference { return item; });
+        }
+
+        // Sorts by key(element), e.g. a member of a record.
+        template<typename KeyExtractor>
+        void radixSort(KeyExtractor key) {
+            Vector scratch(this->allocator);
+            this->radixSort(scratch, key);
+        }
+
+        template<typename KeyExtractor>
+        void radixSort(Vector &scratch, KeyExtractor key) {
+            static_assert(std::is_trivially_copyable<value_type>::value,
+                          "radixSort copies elements bytewise into the scratch buffer");
+            if (this->size <= smallSortLimit) {
+                sortingNetwork(this->storage, this->size, key);
+                return;
+            }
+
+            using bits_type = decltype(radixBits(key(this->storage[0])));
+            constexpr size_type digitCount = sizeof(bits_type);
+            size_type counts[digitCount][256] = {};
+            const pointer last = this->storage + this->size;
+            for (pointer it = this->storage; it != last; ++it) {
+                const bits_type bits = radixBits(key(*it));
+                for (size_type digit = 0; digit < digitCount; ++digit) {
+                    ++counts[digit][(bits >> (8 * digit)) & 0xFF];
+                }
+            }
+
+            scratch.erase(scratch.cbegin(), scratch.cend());
+            scratch.reserve(this->size);
+            pointer from = this->storage;
+            pointer to = scratch.storage;
+            const bits_type firstBits = radixBits(key(*from));
+            for (size_type digit = 0; digit < digitCount; ++digit) {
+                const size_type shift = 8 * digit;
+                size_type *const count = counts[digit];
+                // a byte shared by every key would leave the order as it is.
+                if (count[(firstBits >> shift) & 0xFF] == this->size) {
+                    continue;
+                }
+                size_type offset = 0;
+                for (size_type value = 0; value < 256; ++value) {
+                    const size_type bucketSize = count[value];
+                    count[value] = offset;
+                    offset += bucketSize;
+                }
+                for (pointer it = from; it != from + this->size; ++it) {
+                    std::memcpy(static_cast<void *>(to + count[(radixBits(key(*it)) >> shift) & 0xFF]++), it,
+                                sizeof(value_type));
+                }
+                std::swap(from, to);
+            }
+            if (from != this->storage) {
+                std::memcpy(static_cast<void *>(this->storage), from, this->size * sizeof(value_type));
+            }
         }
 
         iterator begin() {
@@ -164,17 +419,533 @@ namespace aisdi {
             return cend();
         }
 
+    protected:
+        bool usesInlineStorage() const {
+            return this->inlineStorage;
+        }
+
+        // Move assignment accepting elements kept inline by other, which are moved one by one and may
+        // need a buffer to be allocated; hence not noexcept.
+        void moveFrom(Vector &other) {
+            if (this == &other) {
+                return;
+            }
+            if (!other.inlineStorage) {
+                *this = std::move(other);
+                return;
+            }
+            this->destroy(this->storage, this->storage + this->size);
+            this->size = 0;
+            this->takeElements(other);
+        }
+
+        // Moves the elements into a buffer owned by a derived class (see SmallVector), which has to fit them
+        // all. The vector never releases that buffer, and switches to its allocator once the elements no
+        // longer fit.
+        void adoptInlineStorage(pointer buffer, size_type capacity) {
+            if (this->inlineStorage) {
+                return;
+            }
+            const pointer oldStorage = this->storage;
+            const size_type oldReservedSize = this->reserved_size;
+            if (this->size != 0) {
+                this->relocateAround(buffer, this->size, 0, trivially_relocatable());
+            }
+            this->storage = buffer;
+            this->reserved_size = capacity;
+            this->inlineStorage = true;
+            this->deallocate(oldStorage, oldReservedSize);
+        }
+
     private:
+        using allocator_traits = std::allocator_traits<Allocator>;
+
+        // The smallest buffer a growing vector allocates, so that short vectors do not reallocate on each append.
+        static constexpr size_type minimalCapacity = 4;
+
+        allocator_type allocator;
+        bool inlineStorage;
         pointer storage;
         size_type size;
         size_type reserved_size;
 
-        void reallocate() {
-            this->reserved_size = this->reserved_size + this->reserved_size / 2 + 1;
-            const auto newStorage = new value_type[this->reserved_size];
-            std::copy(this->cbegin(), this->cend(), newStorage);
-            delete[] storage;
+        pointer allocate(size_type count) {
+            return count != 0 ? allocator_traits::allocate(this->allocator, count) : nullptr;
+        }
+
+        void deallocate(pointer buffer, size_type count) {
+            if (buffer != nullptr) {
+                allocator_traits::deallocate(this->allocator, buffer, count);
+            }
+        }
+
+        // Switches to a heap buffer (or none), releasing the current one unless a derived class owns it.
+        void replaceStorage(pointer newStorage, size_type newReservedSize) {
+            if (!this->inlineStorage) {
+                this->deallocate(this->storage, this->reserved_size);
+            }
             this->storage = newStorage;
+            this->reserved_size = newReservedSize;
+            this->inlineStorage = false;
+        }
+
+        // Moves the elements of other into this empty vector, leaving other empty.
+        void takeElements(Vector &other) {
+            this->reserve(other.size);
+            this->moveConstruct(other.storage, other.storage + other.size, this->storage);
+            this->size = other.size;
+            other.destroy(other.storage, other.storage + other.size);
+            other.size = 0;
+        }
+
+        // Takes over the allocator of the assigned container when the allocator asks for it.
+        template<typename OtherAllocator>
+        void propagateAllocator(OtherAllocator &&other, std::true_type) {
+            this->allocator = std::forward<OtherAllocator>(other);
+        }
+
+        template<typename OtherAllocator>
+        void propagateAllocator(OtherAllocator &&, std::false_type) {}
+
+        using trivially_copyable = std::integral_constant<bool, std::is_trivially_copyable<value_type>::value>;
+        using trivially_relocatable = std::integral_constant<bool, is_trivially_relocatable<value_type>::value>;
+
+        void destroy(pointer first, pointer last) {
+            if (std::is_trivially_destructible<value_type>::value) {
+                return;
+            }
+            for (; first != last; ++first) {
+                allocator_traits::destroy(this->allocator, first);
+            }
+        }
+
+        // Constructs copies of [first, last) past the current end. On failure the vector keeps its
+        // already constructed elements and frees the buffer if it was just allocated for them.
+        void copyConstruct(const_pointer first, const_pointer last) {
+            this->copyConstruct(first, last, trivially_copyable());
+        }
+
+        void copyConstruct(const_pointer first, const_pointer last, std::true_type) {
+            if (first != last) {
+                std::memcpy(this->storage + this->size, first, (last - first) * sizeof(value_type));
+                this->size += last - first;
+            }
+        }
+
+        void copyConstruct(const_pointer first, const_pointer last, std::false_type) {
+            try {
+                for (; first != last; ++first) {
+                    allocator_traits::construct(this->allocator, this->storage + this->size, *first);
+                    ++this->size;
+                }
+            } catch (...) {
+                this->destroy(this->storage, this->storage + this->size);
+                this->size = 0;
+                this->replaceStorage(nullptr, 0);
+                throw;
+            }
+        }
+
+        // Moves [first, last) into raw memory at destination. Types whose move constructor may throw
+        // are copied instead, so the sources stay intact if construction fails.
+        void moveConstruct(pointer first, pointer last, pointer destination) {
+            pointer constructed = destination;
+            try {
+                for (; first != last; ++first, ++constructed) {
+                    allocator_traits::construct(this->allocator, constructed, std::move_if_noexcept(*first));
+                }
+            } catch (...) {
+                this->destroy(destination, constructed);
+                throw;
+            }
+        }
+
+        // Places item at position, moving [position, end) one slot to the right; the end slot must be allocated.
+        void insertMoved(pointer position, value_type &&item, std::true_type) {
+            const size_type count = this->storage + this->size - position;
+            std::memmove(static_cast<void *>(position + 1), position, count * sizeof(value_type));
+            try {
+                allocator_traits::construct(this->allocator, position, std::move(item));
+            } catch (...) {
+                std::memmove(static_cast<void *>(position), position + 1, count * sizeof(value_type));
+                throw;
+            }
+        }
+
+        void insertMoved(pointer position, value_type &&item, std::false_type) {
+            const pointer last = this->storage + this->size;
+            allocator_traits::construct(this->allocator, last, std::move(*(last - 1)));
+            std::move_backward(position, last - 1, last);
+            *position = std::move(item);
+        }
+
+        // Removes [first, last), moving the elements behind it to the front.
+        void shiftLeft(pointer first, pointer last, std::true_type) {
+            this->destroy(first, last);
+            std::memmove(static_cast<void *>(first), last, (this->storage + this->size - last) * sizeof(value_type));
+        }
+
+        void shiftLeft(pointer first, pointer last, std::false_type) {
+            const pointer newEnd = std::move(last, this->storage + this->size, first);
+            this->destroy(newEnd, this->storage + this->size);
+        }
+
+        // Relocates the elements into newStorage leaving a gap of gapSize slots at insertPosition.
+        // The old buffer holds no live objects afterwards.
+        void relocateAround(pointer newStorage, size_type insertPosition, size_type gapSize, std::true_type) {
+            if (insertPosition != 0) {
+                std::memcpy(static_cast<void *>(newStorage), this->storage, insertPosition * sizeof(value_type));
+            }
+            if (insertPosition != this->size) {
+                std::memcpy(static_cast<void *>(newStorage + insertPosition + gapSize), this->storage + insertPosition,
+                            (this->size - insertPosition) * sizeof(value_type));
+            }
+        }
+
+        void relocateAround(pointer newStorage, size_type insertPosition, size_type gapSize, std::false_type) {
+            moveConstruct(this->storage, this->storage + insertPosition, newStorage);
+            if (insertPosition != this->size) {
+                try {
+                    moveConstruct(this->storage + insertPosition, this->storage + this->size,
+                                  newStorage + insertPosition + gapSize);
+                } catch (...) {
+                    this->destroy(newStorage, newStorage + insertPosition);
+                    throw;
+                }
+            }
+            this->destroy(this->storage, this->storage + this->size);
+        }
+
+        void changeCapacity(size_type newReservedSize) {
+            const pointer newStorage = this->allocate(newReservedSize);
+            try {
+                this->relocateAround(newStorage, this->size, 0, trivially_relocatable());
+            } catch (...) {
+                this->deallocate(newStorage, newReservedSize);
+                throw;
+            }
+            this->replaceStorage(newStorage, newReservedSize);
+        }
+
+        size_type grownCapacity(size_type requiredCapacity) const {
+            const size_type grownSize = GrowthPolicy::nextCapacity(this->reserved_size, requiredCapacity,
+                                                                   sizeof(value_type));
+            return grownSize < minimalCapacity ? minimalCapacity : grownSize;
+        }
+
+        template<typename... Args>
+        void reallocate(size_type insertPosition, Args &&... args) {
+            const size_type newReservedSize = this->grownCapacity(this->size + 1);
+            const pointer newStorage = this->allocate(newReservedSize);
+            try {
+                allocator_traits::construct(this->allocator, newStorage + insertPosition, std::forward<Args>(args)...);
+                try {
+                    this->relocateAround(newStorage, insertPosition, 1, trivially_relocatable());
+                } catch (...) {
+                    this->destroy(newStorage + insertPosition, newStorage + insertPosition + 1);
+                    throw;
+                }
+            } catch (...) {
+                this->deallocate(newStorage, newReservedSize);
+                throw;
+            }
+            this->replaceStorage(newStorage, newReservedSize);
+            ++this->size;
+        }
+
+        // Constructs copies of count elements starting at first in raw memory at destination.
+        template<typename ForwardIterator>
+        void constructRange(pointer destination, ForwardIterator first, size_type count) {
+            pointer constructed = destination;
+            try {
+                for (; constructed != destination + count; ++constructed, ++first) {
+                    allocator_traits::construct(this->allocator, constructed, *first);
+                }
+            } catch (...) {
+                this->destroy(destination, constructed);
+                throw;
+            }
+        }
+
+        template<typename InputIterator>
+        void insertRange(size_type insertPosition, InputIterator first, InputIterator last, std::input_iterator_tag) {
+            // the length is unknown up front, so the items are gathered first and then inserted in one go.
+            Vector items(this->allocator);
+            for (; first != last; ++first) {
+                items.append(*first);
+            }
+            this->insertRange(insertPosition, std::make_move_iterator(items.storage),
+                              std::make_move_iterator(items.storage + items.size), std::forward_iterator_tag());
+        }
+
+        template<typename ForwardIterator>
+        void insertRange(size_type insertPosition, ForwardIterator first, ForwardIterator last,
+                         std::forward_iterator_tag) {
+            const size_type count = static_cast<size_type>(std::distance(first, last));
+            if (count == 0) {
+                return;
+            }
+            // compared without adding to size: a sum wrapping around would reach the in-place path.
+            if (count > this->reserved_size - this->size) {
+                this->reallocateRange(insertPosition, first, count);
+                return;
+            }
+            this->insertRangeInPlace(this->storage + insertPosition, first, count, trivially_relocatable());
+        }
+
+        // Grows once, constructing the new items straight into their place in the new buffer.
+        template<typename ForwardIterator>
+        void reallocateRange(size_type insertPosition, ForwardIterator first, size_type count) {
+            const size_type newReservedSize = this->grownCapacity(this->size + count);
+            const pointer newStorage = this->allocate(newReservedSize);
+            try {
+                this->constructRange(newStorage + insertPosition, first, count);
+                try {
+                    this->relocateAround(newStorage, insertPosition, count, trivially_relocatable());
+                } catch (...) {
+                    this->destroy(newStorage + insertPosition, newStorage + insertPosition + count);
+                    throw;
+                }
+            } catch (...) {
+                this->deallocate(newStorage, newReservedSize);
+                throw;
+            }
+            this->replaceStorage(newStorage, newReservedSize);
+            this->size += count;
+        }
+
+        // Opens a gap of count slots at position with a single shift of the tail, then fills it.
+        template<typename ForwardIterator>
+        void insertRangeInPlace(pointer position, ForwardIterator first, size_type count, std::true_type) {
+            const size_type tailSize = this->storage + this->size - position;
+            std::memmove(static_cast<void *>(position + count), position, tailSize * sizeof(value_type));
+            try {
+                this->constructRange(position, first, count);
+            } catch (...) {
+                std::memmove(static_cast<void *>(position), position + count, tailSize * sizeof(value_type));
+                throw;
+            }
+            this->size += count;
+        }
+
+        template<typename ForwardIterator>
+        void insertRangeInPlace(pointer position, ForwardIterator first, size_type count, std::false_type) {
+            const pointer oldEnd = this->storage + this->size;
+            const size_type tailSize = oldEnd - position;
+            if (tailSize > count) {
+                this->moveConstruct(oldEnd - count, oldEnd, oldEnd);
+                this->size += count;
+                std::move_backward(position, oldEnd - count, oldEnd);
+                std::copy_n(first, count, position);
+            } else {
+                // the part of the range falling past the old end is constructed, the rest assigned.
+                const ForwardIterator middle = std::next(first, tailSize);
+                this->constructRange(oldEnd, middle, count - tailSize);
+                this->size += count - tailSize;
+                this->moveConstruct(position, oldEnd, this->storage + this->size);
+                this->size += tailSize;
+                std::copy(first, middle, position);
+            }
+        }
+
+        // Ranges this short are left to insertion sort by both sorts.
+        static constexpr size_type insertionSortCutoff = 16;
+
+        template<typename Compare>
+        static void insertionSort(pointer first, pointer last, Compare &compare) {
+            if (first == last) {
+                return;
+            }
+            for (pointer it = first + 1; it != last; ++it) {
+                if (compare(*it, *first)) {
+                    value_type item(std::move(*it));
+                    std::move_backward(first, it, it + 1);
+                    *first = std::move(item);
+                } else if (compare(*it, *(it - 1))) {
+                    // the first element is not greater, so it stops the walk without a bounds check.
+                    value_type item(std::move(*it));
+                    pointer hole = it;
+                    for (; compare(item, *(hole - 1)); --hole) {
+                        *hole = std::move(*(hole - 1));
+                    }
+                    *hole = std::move(item);
+                }
+            }
+        }
+
+        // Swaps the median of a, b and c into result.
+        template<typename Compare>
+        static void moveMedianTo(pointer result, pointer a, pointer b, pointer c, Compare &compare) {
+            if (compare(*a, *b)) {
+                if (compare(*b, *c)) {
+                    std::iter_swap(result, b);
+                } else if (compare(*a, *c)) {
+                    std::iter_swap(result, c);
+                } else {
+                    std::iter_swap(result, a);
+                }
+            } else if (compare(*a, *c)) {
+                std::iter_swap(result, a);
+            } else if (compare(*b, *c)) {
+                std::iter_swap(result, c);
+            } else {
+                std::iter_swap(result, b);
+            }
+        }
+
+        // Partitions (first, last) around the pivot at first. The median of three guarantees an element on
+        // either side to stop the scans, so they need no bounds checks.
+        template<typename Compare>
+        static pointer partition(pointer first, pointer last, Compare &compare) {
+            moveMedianTo(first, first + 1, first + (last - first) / 2, last - 1, compare);
+            pointer left = first + 1;
+            pointer right = last;
+            while (true) {
+                while (compare(*left, *first)) {
+                    ++left;
+                }
+                --right;
+                while (compare(*first, *right)) {
+                    --right;
+                }
+                if (!(left < right)) {
+                    return left;
+                }
+                std::iter_swap(left, right);
+                ++left;
+            }
+        }
+
+        // Recurses into the shorter side and loops on the longer one, so the stack stays logarithmic.
+        template<typename Compare>
+        static void introsort(pointer first, pointer last, size_type depthLimit, Compare &compare) {
+            while (last - first > static_cast<difference_type>(insertionSortCutoff)) {
+                if (depthLimit == 0) {
+                    std::make_heap(first, last, compare);
+                    std::sort_heap(first, last, compare);
+                    return;
+                }
+                --depthLimit;
+                const pointer cut = partition(first, last, compare);
+                if (cut - first < last - cut) {
+                    introsort(first, cut, depthLimit, compare);
+                    first = cut;
+                } else {
+                    introsort(cut, last, depthLimit, compare);
+                    last = cut;
+                }
+            }
+            insertionSort(first, last, compare);
+        }
+
+        // Merges the sorted runs [first, middle) and [middle, last), moving the shorter one into scratch.
+        // If compare throws, the elements still held by scratch are moved back into the gap left for them.
+        template<typename Compare>
+        void mergeRuns(pointer first, pointer middle, pointer last, pointer scratch, Compare &compare) {
+            if (!compare(*middle, *(middle - 1))) {
+                return;
+            }
+            if (middle - first <= last - middle) {
+                const pointer scratchEnd = scratch + (middle - first);
+                this->moveConstruct(first, middle, scratch);
+                pointer left = scratch;
+                pointer right = middle;
+                pointer out = first;
+                try {
+                    for (; left != scratchEnd && right != last; ++out) {
+                        *out = compare(*right, *left) ? std::move(*right++) : std::move(*left++);
+                    }
+                } catch (...) {
+                    std::move(left, scratchEnd, out);
+                    this->destroy(scratch, scratchEnd);
+                    throw;
+                }
+                std::move(left, scratchEnd, out);
+                this->destroy(scratch, scratchEnd);
+            } else {
+                const pointer scratchEnd = scratch + (last - middle);
+                this->moveConstruct(middle, last, scratch);
+                pointer left = middle;
+                pointer right = scratchEnd;
+                pointer out = last;
+                try {
+                    for (; left != first && right != scratch;) {
+                        *--out = compare(*(right - 1), *(left - 1)) ? std::move(*--left) : std::move(*--right);
+                    }
+                } catch (...) {
+                    std::move_backward(scratch, right, out);
+                    this->destroy(scratch, scratchEnd);
+                    throw;
+                }
+                std::move_backward(scratch, right, out);
+                this->destroy(scratch, scratchEnd);
+            }
+        }
+
+        // Vectors up to this size are sorted by radixSort with a sorting network.
+        static constexpr size_type smallSortLimit = 32;
+
+        // Maps a key to unsigned bits ordered the same way: signed integers get their sign bit flipped,
+        // negative floats all their bits and positive floats the sign bit.
+        template<typename Key, typename = typename std::enable_if<std::is_integral<Key>::value>::type>
+        static typename std::make_unsigned<Key>::type radixBits(Key key) {
+            static_assert(!std::is_same<Key, bool>::value, "radixSort needs a numeric key");
+            using bits_type = typename std::make_unsigned<Key>::type;
+            const bits_type signBit = std::is_signed<Key>::value ?
+                                      bits_type(bits_type(1) << (std::numeric_limits<bits_type>::digits - 1)) : 0;
+            return static_cast<bits_type>(static_cast<bits_type>(key) ^ signBit);
+        }
+
+        static std::uint32_t radixBits(float key) {
+            std::uint32_t bits;
+            std::memcpy(&bits, &key, sizeof(bits));
+            return bits ^ ((bits >> 31) != 0 ? 0xFFFFFFFFu : 0x80000000u);
+        }
+
+        static std::uint64_t radixBits(double key) {
+            std::uint64_t bits;
+            std::memcpy(&bits, &key, sizeof(bits));
+            return bits ^ ((bits >> 63) != 0 ? 0xFFFFFFFFFFFFFFFFull : 0x8000000000000000ull);
+        }
+
+        // Batcher's merge exchange (Knuth, TAOCP 5.2.2, algorithm M) for any count. Which pairs get
+        // compared does not depend on the data. Exchanging pairs far apart is what makes it unstable.
+        template<typename KeyExtractor>
+        static void sortingNetwork(pointer first, size_type count, KeyExtractor &key) {
+            if (count < 2) {
+                return;
+            }
+            size_type top = 1;
+            while (top * 2 < count) {
+                top *= 2;
+            }
+            for (size_type p = top; p > 0; p /= 2) {
+                size_type q = top;
+                size_type r = 0;
+                size_type d = p;
+                while (true) {
+                    for (size_type i = 0; i + d < count; ++i) {
+                        if ((i & p) == r) {
+                            compareExchange(first + i, first + i + d, key);
+                        }
+                    }
+                    if (q == p) {
+                        break;
+                    }
+                    d = q - p;
+                    q /= 2;
+                    r = p;
+                }
+            }
+        }
+
+        // Compares the keys in place and swaps only a pair out of order; for scalars compilers usually turn
+        // the swap into selects, while records are not copied whole on every comparison.
+        template<typename KeyExtractor>
+        static void compareExchange(pointer a, pointer b, KeyExtractor &key) {
+            if (radixBits(key(*b)) < radixBits(key(*a))) {
+                std::swap(*a, *b);
+            }
         }
 
         void checkNotEmpty() {
@@ -184,22 +955,46 @@ namespace aisdi {
         }
     };
 
-    template<typename Type>
-    class Vector<Type>::ConstIterator {
+    // With AISDI_CHECKED_ITERATORS the iterators remember their vector and throw std::out_of_range when
+    // stepped or dereferenced past its bounds. Without it they are plain pointers.
+    template<typename Type, typename GrowthPolicy, typename Allocator>
+    class Vector<Type, GrowthPolicy, Allocator>::ConstIterator {
     public:
-        using iterator_category = std::bidirectional_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
         using value_type = typename Vector::value_type;
         using difference_type = typename Vector::difference_type;
         using pointer = typename Vector::const_pointer;
         using reference = typename Vector::const_reference;
 
-        explicit ConstIterator(pointer current, const Vector<value_type> &vector) : current(current), vector(vector) {}
+        ConstIterator() : current(nullptr) {
+#if AISDI_CHECKED_ITERATORS
+            this->vector = nullptr;
+#endif
+        }
+
+        explicit ConstIterator(pointer current, const Vector &vector) : current(current) {
+#if AISDI_CHECKED_ITERATORS
+            this->vector = &vector;
+#else
+            (void) vector;
+#endif
+        }
 
         reference operator*() const {
             this->checkIsNotEnd();
             return *(current);
         }
 
+        pointer operator->() const {
+            this->checkIsNotEnd();
+            return current;
+        }
+
+        reference operator[](difference_type d) const {
+            this->checkIsDereferenceable(d);
+            return current[d];
+        }
+
         ConstIterator &operator++() {
             this->checkIsNotEnd();
             ++current;
@@ -242,6 +1037,10 @@ namespace aisdi {
             return result;
         }
 
+        friend ConstIterator operator+(difference_type d, const ConstIterator &it) {
+            return it + d;
+        }
+
         difference_type operator-(const ConstIterator &other) const {
             return current - other.current;
         }
@@ -260,30 +1059,65 @@ namespace aisdi {
             return !(*this == other);
         }
 
+        bool operator<(const ConstIterator &other) const {
+            return current < other.current;
+        }
+
+        bool operator>(const ConstIterator &other) const {
+            return other < *this;
+        }
+
+        bool operator<=(const ConstIterator &other) const {
+            return !(other < *this);
+        }
+
+        bool operator>=(const ConstIterator &other) const {
+            return !(*this < other);
+        }
+
     private:
         pointer current;
-        const Vector<value_type> &vector;
+#if AISDI_CHECKED_ITERATORS
+        const Vector *vector;
+#endif
 
         void checkIsNotEnd() const {
-            if (*this == vector.end()) {
+#if AISDI_CHECKED_ITERATORS
+            if (*this == vector->end()) {
                 throw std::out_of_range("Iterator is out of range");
             }
+#endif
         }
 
         void checkIsNotBegin() const {
-            if (*this == vector.begin()) {
+#if AISDI_CHECKED_ITERATORS
+            if (*this == vector->begin()) {
                 throw std::out_of_range("Iterator is out of range");
             }
-        };
+#endif
+        }
+
+        void checkIsDereferenceable(difference_type d) const {
+#if AISDI_CHECKED_ITERATORS
+            const auto target = *this + d;
+            if (target < vector->begin() || !(target < vector->end())) {
+                throw std::out_of_range("Iterator is out of range");
+            }
+#else
+            (void) d;
+#endif
+        }
     };
 
-    template<typename Type>
-    class Vector<Type>::Iterator : public Vector<Type>::ConstIterator {
+    template<typename Type, typename GrowthPolicy, typename Allocator>
+    class Vector<Type, GrowthPolicy, Allocator>::Iterator : public Vector<Type, GrowthPolicy, Allocator>::ConstIterator {
     public:
         using pointer = typename Vector::pointer;
         using reference = typename Vector::reference;
 
-        explicit Iterator(pointer current, const Vector<value_type> &vector) : ConstIterator(current, vector) {}
+        Iterator() {}
+
+        explicit Iterator(pointer current, const Vector &vector) : ConstIterator(current, vector) {}
 
         Iterator(const ConstIterator &other) : ConstIterator(other) {}
 
@@ -309,20 +1143,51 @@ namespace aisdi {
             return result;
         }
 
+        Iterator &operator+=(difference_type d) {
+            ConstIterator::operator+=(d);
+            return *this;
+        }
+
+        Iterator &operator-=(difference_type d) {
+            ConstIterator::operator-=(d);
+            return *this;
+        }
+
         Iterator operator+(difference_type d) const {
             return ConstIterator::operator+(d);
         }
 
+        friend Iterator operator+(difference_type d, const Iterator &it) {
+            return it + d;
+        }
+
         Iterator operator-(difference_type d) const {
             return ConstIterator::operator-(d);
         }
 
+        using ConstIterator::operator-;
+
         reference operator*() const {
             // ugly cast, yet reduces code duplication.
             return const_cast<reference>(ConstIterator::operator*());
         }
+
+        pointer operator->() const {
+            return const_cast<pointer>(ConstIterator::operator->());
+        }
+
+        reference operator[](difference_type d) const {
+            return const_cast<reference>(ConstIterator::operator[](d));
+        }
     };
 
+    namespace pmr {
+
+        template<typename Type, typename GrowthPolicy = OneAndHalfGrowth>
+        using Vector = aisdi::Vector<Type, GrowthPolicy, std::pmr::polymorphic_allocator<Type>>;
+
+    }
+
 }
 
 #endif // AISDI_LINEAR_VECTOR_H
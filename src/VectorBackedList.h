@@ -0,0 +1,799 @@
+#ifndef AISDI_LINEAR_VECTORBACKEDLIST_H
+#define AISDI_LINEAR_VECTORBACKEDLIST_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "GrowthPolicy.h"
+#include "TypeTraits.h"
+#include "Vector.h"
+
+namespace aisdi {
+
+    // Doubly linked list whose nodes are slots of two parallel arrays: a Vector of 32-bit index links
+    // and a buffer of values. Erased slots go to a free list threaded through the links and are reused
+    // before the arrays grow. A node costs 8 bytes of links on top of its value, neighbours in the list
+    // tend to be neighbours in memory, and a trivially copyable list is copied as two flat blocks.
+    // Growing the arrays invalidates references to the values, not iterators.
+    //
+    // The interface is LinkedList's. Values never leave the slots of their arrays, though, so splicing
+    // from another list moves the values into slots of this one; only splicing within one list, or a
+    // whole list into an empty one, relinks.
+    template<typename Type, typename Allocator = std::allocator<Type>>
+    class VectorBackedList {
+    private:
+        using difference_type = std::ptrdiff_t;
+        using size_type = std::size_t;
+        using value_type = Type;
+        using pointer = Type *;
+        using reference = Type &;
+        using const_pointer = const Type *;
+        using const_reference = const Type &;
+
+        class ConstIterator;
+
+        class Iterator;
+
+        using const_iterator = ConstIterator;
+        using iterator = Iterator;
+
+        using index_type = std::uint32_t;
+
+        // Marks the missing neighbour of the first and last node; the end iterator points at it as well.
+        static constexpr index_type npos = static_cast<index_type>(-1);
+
+        struct link {
+            index_type next;
+            index_type prev;
+        };
+
+        using allocator_traits = std::allocator_traits<Allocator>;
+        using link_allocator_type = typename allocator_traits::template rebind_alloc<link>;
+        using links_type = Vector<link, OneAndHalfGrowth, link_allocator_type>;
+
+        using trivially_copyable = std::integral_constant<bool, std::is_trivially_copyable<value_type>::value>;
+        using trivially_relocatable = std::integral_constant<bool, is_trivially_relocatable<value_type>::value>;
+
+        Allocator allocator;
+        links_type links;
+        // values[i] holds the value of the node linked by links[i]; it is raw memory for free slots.
+        pointer values;
+        size_type capacity;
+        index_type head;
+        index_type tail;
+        index_type freeHead;
+        size_type size;
+
+        void checkNotEmpty() {
+            if (this->isEmpty()) {
+                throw std::logic_error("Collection is empty.");
+            }
+        }
+
+        link &linkAt(index_type index) {
+            return this->links.data()[index];
+        }
+
+        const link &linkAt(index_type index) const {
+            return this->links.data()[index];
+        }
+
+        void destroyValues() {
+            if (std::is_trivially_destructible<value_type>::value) {
+                return;
+            }
+            for (index_type it = this->head; it != npos; it = linkAt(it).next) {
+                allocator_traits::destroy(this->allocator, this->values + it);
+            }
+        }
+
+        void releaseValues() {
+            if (this->values != nullptr) {
+                allocator_traits::deallocate(this->allocator, this->values, this->capacity);
+            }
+            this->values = nullptr;
+            this->capacity = 0;
+        }
+
+        // Moves the live values into newValues, keeping their slots.
+        void relocateValues(pointer newValues, std::true_type) {
+            if (this->links.getSize() != 0) {
+                std::memcpy(static_cast<void *>(newValues), this->values, this->links.getSize() * sizeof(value_type));
+            }
+        }
+
+        void relocateValues(pointer newValues, std::false_type) {
+            index_type it = this->head;
+            try {
+                for (; it != npos; it = linkAt(it).next) {
+                    allocator_traits::construct(this->allocator, newValues + it, std::move_if_noexcept(this->values[it]));
+                }
+            } catch (...) {
+                for (index_type constructed = this->head; constructed != it; constructed = linkAt(constructed).next) {
+                    allocator_traits::destroy(this->allocator, newValues + constructed);
+                }
+                throw;
+            }
+            this->destroyValues();
+        }
+
+        void changeCapacity(size_type newCapacity) {
+            if (newCapacity > static_cast<size_type>(npos)) {
+                throw std::length_error("Collection is too large.");
+            }
+            this->links.reserve(newCapacity);
+            const pointer newValues = allocator_traits::allocate(this->allocator, newCapacity);
+            try {
+                this->relocateValues(newValues, trivially_relocatable());
+            } catch (...) {
+                allocator_traits::deallocate(this->allocator, newValues, newCapacity);
+                throw;
+            }
+            this->releaseValues();
+            this->values = newValues;
+            this->capacity = newCapacity;
+        }
+
+        // Takes a slot from the free list, or a new one at the end of the arrays.
+        index_type acquireSlot() {
+            if (this->freeHead != npos) {
+                const index_type slot = this->freeHead;
+                this->freeHead = linkAt(slot).next;
+                return slot;
+            }
+            if (this->links.getSize() == this->capacity) {
+                const size_type grown = OneAndHalfGrowth::nextCapacity(this->capacity, this->capacity + 1,
+                                                                       sizeof(value_type));
+                this->changeCapacity(grown < 4 ? 4 : grown);
+            }
+            this->links.append(link{npos, npos});
+            return static_cast<index_type>(this->links.getSize() - 1);
+        }
+
+        void releaseSlot(index_type slot) {
+            linkAt(slot).next = this->freeHead;
+            this->freeHead = slot;
+        }
+
+        void linkBefore(index_type slot, index_type position) {
+            const index_type prev = position == npos ? this->tail : linkAt(position).prev;
+            linkAt(slot) = link{position, prev};
+            if (prev == npos) {
+                this->head = slot;
+            } else {
+                linkAt(prev).next = slot;
+            }
+            if (position == npos) {
+                this->tail = slot;
+            } else {
+                linkAt(position).prev = slot;
+            }
+        }
+
+        template<typename... Args>
+        void placeBefore(index_type position, Args &&... args) {
+            const index_type slot = this->acquireSlot();
+            try {
+                allocator_traits::construct(this->allocator, this->values + slot, std::forward<Args>(args)...);
+            } catch (...) {
+                this->releaseSlot(slot);
+                throw;
+            }
+            this->linkBefore(slot, position);
+            ++this->size;
+        }
+
+        void unlink(index_type slot) {
+            const link removed = linkAt(slot);
+            if (removed.prev == npos) {
+                this->head = removed.next;
+            } else {
+                linkAt(removed.prev).next = removed.next;
+            }
+            if (removed.next == npos) {
+                this->tail = removed.prev;
+            } else {
+                linkAt(removed.next).prev = removed.prev;
+            }
+        }
+
+        index_type prevOf(index_type slot) const {
+            return slot == npos ? this->tail : linkAt(slot).prev;
+        }
+
+        // Points the neighbour links at each other, where npos stands for the ends of the list.
+        void join(index_type prev, index_type next) {
+            if (prev == npos) {
+                this->head = next;
+            } else {
+                linkAt(prev).next = next;
+            }
+            if (next == npos) {
+                this->tail = prev;
+            } else {
+                linkAt(next).prev = prev;
+            }
+        }
+
+        // Unlinks [first, last), which must not be empty nor hold position, and links it back in before
+        // position.
+        void transferSlots(index_type position, index_type first, index_type last) {
+            const index_type lastIncluded = prevOf(last);
+            this->join(linkAt(first).prev, last);
+            const index_type before = prevOf(position);
+            this->join(before, first);
+            this->join(lastIncluded, position);
+        }
+
+        // Walks from index 0 or from the end, whichever is nearer.
+        index_type slotAt(size_type index) const {
+            if (index == this->size) {
+                return npos;
+            }
+            index_type it;
+            if (index < this->size - index) {
+                it = this->head;
+                for (size_type i = 0; i < index; ++i) {
+                    it = linkAt(it).next;
+                }
+            } else {
+                it = this->tail;
+                for (size_type i = this->size - 1; i > index; --i) {
+                    it = linkAt(it).prev;
+                }
+            }
+            return it;
+        }
+
+        // Merges two sorted chains terminated by npos into merged, taking from left on ties. If compare
+        // throws, merged still receives every node of both chains, out of order.
+        template<typename Compare>
+        void mergeChains(index_type left, index_type right, index_type &merged, Compare &compare) {
+            index_type *tail = &merged;
+            try {
+                while (left != npos && right != npos) {
+                    index_type &taken = compare(this->values[right], this->values[left]) ? right : left;
+                    *tail = taken;
+                    tail = &linkAt(taken).next;
+                    taken = linkAt(taken).next;
+                }
+            } catch (...) {
+                *tail = left;
+                for (; *tail != npos; tail = &linkAt(*tail).next);
+                *tail = right;
+                throw;
+            }
+            *tail = left != npos ? left : right;
+        }
+
+        // Makes the chain starting at first the list, restoring the prev links.
+        void relinkChain(index_type first) {
+            index_type prev = npos;
+            for (index_type it = first; it != npos; it = linkAt(it).next) {
+                linkAt(it).prev = prev;
+                prev = it;
+            }
+            this->head = first;
+            this->tail = prev;
+        }
+
+        void resetLinks() {
+            this->links.erase(this->links.cbegin(), this->links.cend());
+            this->head = this->tail = this->freeHead = npos;
+            this->size = 0;
+        }
+
+        // A trivially copyable list is copied slot by slot, free slots included.
+        void copyFrom(const VectorBackedList &other, std::true_type) {
+            if (other.links.getSize() == 0) {
+                return;
+            }
+            this->reserve(other.links.getSize());
+            this->links.append(other.links.cbegin(), other.links.cend());
+            std::memcpy(static_cast<void *>(this->values), other.values, other.links.getSize() * sizeof(value_type));
+            this->head = other.head;
+            this->tail = other.tail;
+            this->freeHead = other.freeHead;
+            this->size = other.size;
+        }
+
+        void copyFrom(const VectorBackedList &other, std::false_type) {
+            this->reserve(other.size);
+            append(other.begin(), other.end());
+        }
+
+        void swapContents(VectorBackedList &other) noexcept {
+            std::swap(this->links, other.links);
+            std::swap(this->values, other.values);
+            std::swap(this->capacity, other.capacity);
+            std::swap(this->head, other.head);
+            std::swap(this->tail, other.tail);
+            std::swap(this->freeHead, other.freeHead);
+            std::swap(this->size, other.size);
+        }
+
+        template<typename OtherAllocator>
+        void propagateAllocator(OtherAllocator &&other, std::true_type) {
+            this->allocator = std::forward<OtherAllocator>(other);
+        }
+
+        template<typename OtherAllocator>
+        void propagateAllocator(OtherAllocator &&, std::false_type) {}
+
+    public:
+        using allocator_type = Allocator;
+
+        VectorBackedList() : VectorBackedList(allocator_type()) {}
+
+        explicit VectorBackedList(const allocator_type &allocator) noexcept
+                : allocator(allocator), links(link_allocator_type(allocator)), values(nullptr), capacity(0),
+                  head(npos), tail(npos), freeHead(npos), size(0) {}
+
+        VectorBackedList(std::initializer_list<Type> l, const allocator_type &allocator = allocator_type())
+                : VectorBackedList(allocator) {
+            this->reserve(l.size());
+            for (const auto &value : l) {
+                append(value);
+            }
+        }
+
+        VectorBackedList(const VectorBackedList &other)
+                : VectorBackedList(allocator_traits::select_on_container_copy_construction(other.allocator)) {
+            this->copyFrom(other, trivially_copyable());
+        }
+
+        VectorBackedList(VectorBackedList &&other) noexcept : VectorBackedList(other.allocator) {
+            swapContents(other);
+        }
+
+        ~VectorBackedList() {
+            this->destroyValues();
+            this->releaseValues();
+        }
+
+        VectorBackedList &operator=(const VectorBackedList &other) {
+            if (this == &other) {
+                return *this;
+            }
+
+            using propagate = typename allocator_traits::propagate_on_container_copy_assignment;
+            clear();
+            if (propagate::value && this->allocator != other.allocator) {
+                this->releaseValues();
+                this->links = links_type(link_allocator_type(other.allocator));
+                this->propagateAllocator(other.allocator, propagate());
+            }
+            this->copyFrom(other, trivially_copyable());
+            return *this;
+        }
+
+        VectorBackedList &operator=(VectorBackedList &&other) noexcept(
+                allocator_traits::propagate_on_container_move_assignment::value ||
+                allocator_traits::is_always_equal::value) {
+            if (this == &other) {
+                return *this;
+            }
+
+            using propagate = typename allocator_traits::propagate_on_container_move_assignment;
+            clear();
+            if (!propagate::value && this->allocator != other.allocator) {
+                // the arrays cannot change hands between unequal allocators, so the values are moved one by one.
+                for (auto &value : other) {
+                    append(std::move(value));
+                }
+                return *this;
+            }
+            this->releaseValues();
+            this->propagateAllocator(std::move(other.allocator), propagate());
+            swapContents(other);
+            return *this;
+        }
+
+        allocator_type getAllocator() const {
+            return this->allocator;
+        }
+
+        bool isEmpty() const {
+            return this->size == 0;
+        }
+
+        size_type getSize() const {
+            return this->size;
+        }
+
+        // Makes room for count elements in total, so that adding them does not grow the arrays.
+        void reserve(size_type count) {
+            if (count > this->capacity) {
+                this->changeCapacity(count);
+            }
+        }
+
+        // Positional access walks from the nearer end of the list.
+        reference at(size_type index) {
+            return const_cast<reference>(static_cast<const VectorBackedList &>(*this).at(index));
+        }
+
+        const_reference at(size_type index) const {
+            if (index >= this->size) {
+                throw std::out_of_range("Index is out of range");
+            }
+            return this->values[this->slotAt(index)];
+        }
+
+        iterator iteratorAt(size_type index) {
+            return static_cast<const VectorBackedList &>(*this).iteratorAt(index);
+        }
+
+        const_iterator iteratorAt(size_type index) const {
+            if (index > this->size) {
+                throw std::out_of_range("Index is out of range");
+            }
+            return const_iterator(this->slotAt(index), *this);
+        }
+
+        void append(const Type &item) {
+            emplaceAppend(item);
+        }
+
+        void append(Type &&item) {
+            emplaceAppend(std::move(item));
+        }
+
+        void append(const const_iterator &start, const const_iterator &end) {
+            for (auto it = start; it != end; ++it) {
+                append(*it);
+            }
+        }
+
+        void prepend(const Type &item) {
+            emplacePrepend(item);
+        }
+
+        void prepend(Type &&item) {
+            emplacePrepend(std::move(item));
+        }
+
+        void insert(const const_iterator &insertPosition, const Type &item) {
+            emplace(insertPosition, item);
+        }
+
+        void insert(const const_iterator &insertPosition, Type &&item) {
+            emplace(insertPosition, std::move(item));
+        }
+
+        template<typename... Args>
+        void emplaceAppend(Args &&... args) {
+            emplace(cend(), std::forward<Args>(args)...);
+        }
+
+        template<typename... Args>
+        void emplacePrepend(Args &&... args) {
+            emplace(cbegin(), std::forward<Args>(args)...);
+        }
+
+        template<typename... Args>
+        void emplace(const const_iterator &insertPosition, Args &&... args) {
+            if (this->freeHead == npos && this->links.getSize() == this->capacity) {
+                // args may refer to a value about to be relocated, so the item is built first.
+                value_type item(std::forward<Args>(args)...);
+                this->placeBefore(insertPosition.current, std::move(item));
+            } else {
+                this->placeBefore(insertPosition.current, std::forward<Args>(args)...);
+            }
+        }
+
+        Type popFirst() {
+            this->checkNotEmpty();
+            auto first = std::move(*this->begin());
+            erase(this->begin());
+            return first;
+        }
+
+        Type popLast() {
+            this->checkNotEmpty();
+            auto last = std::move(*(--this->end()));
+            erase(--this->end());
+            return last;
+        }
+
+        void erase(const const_iterator &position) {
+            if (position == end()) {
+                throw std::out_of_range("Iterator is out of range");
+            }
+            const index_type slot = position.current;
+            this->unlink(slot);
+            allocator_traits::destroy(this->allocator, this->values + slot);
+            this->releaseSlot(slot);
+            --this->size;
+        }
+
+        void erase(const const_iterator &firstIncluded, const const_iterator &lastExcluded) {
+            for (auto toDelete = firstIncluded; toDelete != lastExcluded;) {
+                erase(toDelete++);
+            }
+        }
+
+        // Empties the list, keeping the arrays for reuse.
+        void clear() {
+            this->destroyValues();
+            this->resetLinks();
+        }
+
+        // Moves all items of other before position. Into an empty list the arrays change hands, when the
+        // allocators allow it; otherwise see below.
+        void splice(const const_iterator &position, VectorBackedList &other) {
+            if (&other == this || other.isEmpty()) {
+                return;
+            }
+            splice(position, other, other.cbegin(), other.cend());
+        }
+
+        // As above, for the items [first, last) of other. Within one list the range is relinked in O(1)
+        // after a walk over it, which makes splicing it before a position inside it, or before last, a
+        // no-op. From another list the values are moved into slots of this list in O(k) and iterators to
+        // them invalidated; should a move throw, the items before it have been moved already.
+        void splice(const const_iterator &position, VectorBackedList &other,
+                    const const_iterator &first, const const_iterator &last) {
+            if (first == last) {
+                return;
+            }
+            if (&other == this) {
+                for (index_type it = first.current; it != last.current; it = linkAt(it).next) {
+                    if (it == position.current) {
+                        return;
+                    }
+                }
+                if (position != last) {
+                    this->transferSlots(position.current, first.current, last.current);
+                }
+                return;
+            }
+            if (this->isEmpty() && first == other.cbegin() && last == other.cend() &&
+                this->allocator == other.allocator) {
+                this->destroyValues();
+                this->releaseValues();
+                this->resetLinks();
+                this->swapContents(other);
+                return;
+            }
+
+            size_type count = 0;
+            for (index_type it = first.current; it != last.current; it = other.linkAt(it).next) {
+                ++count;
+            }
+            this->reserve(this->size + count);
+            for (index_type it = first.current; it != last.current;) {
+                const index_type next = other.linkAt(it).next;
+                this->placeBefore(position.current, std::move(other.values[it]));
+                other.erase(const_iterator(it, other));
+                it = next;
+            }
+        }
+
+        void concatenate(VectorBackedList &other) {
+            splice(cend(), other);
+        }
+
+        // Moves the items from position to the end into a new list; from the first item, the arrays
+        // change hands.
+        VectorBackedList splitAt(const const_iterator &position) {
+            VectorBackedList rest(this->allocator);
+            rest.splice(rest.cend(), *this, position, cend());
+            return rest;
+        }
+
+        // Stable bottom-up merge sort. Only the links are rewritten: values stay in their slots, so
+        // iterators stay valid and follow their items. runs[k] holds a sorted run of 2^k nodes, merged
+        // upwards as in a binary counter. If compare throws, the list keeps all its items in an
+        // unspecified order.
+        template<typename Compare = std::less<Type>>
+        void sort(Compare compare = Compare()) {
+            if (this->size < 2) {
+                return;
+            }
+
+            index_type runs[std::numeric_limits<index_type>::digits];
+            std::fill(std::begin(runs), std::end(runs), npos);
+            size_type usedRuns = 0;
+            index_type rest = this->head;
+            index_type run = npos;
+            try {
+                while (rest != npos) {
+                    run = rest;
+                    rest = linkAt(rest).next;
+                    linkAt(run).next = npos;
+                    size_type k = 0;
+                    for (; k < usedRuns && runs[k] != npos; ++k) {
+                        const index_type earlier = runs[k];
+                        runs[k] = npos;
+                        mergeChains(earlier, run, run, compare);
+                    }
+                    if (k == usedRuns) {
+                        ++usedRuns;
+                    }
+                    runs[k] = run;
+                    run = npos;
+                }
+                for (size_type k = 0; k < usedRuns; ++k) {
+                    if (runs[k] != npos) {
+                        const index_type earlier = runs[k];
+                        runs[k] = npos;
+                        mergeChains(earlier, run, run, compare);
+                    }
+                }
+            } catch (...) {
+                // every node is in exactly one of run, runs and rest; they are chained back together.
+                index_type *tail = &run;
+                for (size_type k = 0; k <= usedRuns; ++k) {
+                    for (; *tail != npos; tail = &linkAt(*tail).next);
+                    *tail = k < usedRuns ? runs[k] : rest;
+                }
+                this->relinkChain(run);
+                throw;
+            }
+            this->relinkChain(run);
+        }
+
+        iterator begin() {
+            return iterator(this->head, *this);
+        }
+
+        iterator end() {
+            return iterator(npos, *this);
+        }
+
+        const_iterator cbegin() const {
+            return const_iterator(this->head, *this);
+        }
+
+        const_iterator cend() const {
+            return const_iterator(npos, *this);
+        }
+
+        const_iterator begin() const {
+            return this->cbegin();
+        }
+
+        const_iterator end() const {
+            return this->cend();
+        }
+    };
+
+    template<typename Type, typename Allocator>
+    class VectorBackedList<Type, Allocator>::ConstIterator {
+        friend class VectorBackedList;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = typename VectorBackedList::value_type;
+        using difference_type = typename VectorBackedList::difference_type;
+        using pointer = typename VectorBackedList::const_pointer;
+        using reference = typename VectorBackedList::const_reference;
+
+        explicit ConstIterator(index_type current, const VectorBackedList &list) : current(current), list(&list) {}
+
+        reference operator*() const {
+            checkIsNotEnd();
+            return list->values[this->current];
+        }
+
+        ConstIterator &operator++() {
+            checkIsNotEnd();
+            this->current = list->linkAt(this->current).next;
+            return *this;
+        }
+
+        ConstIterator operator++(int) {
+            const auto current = *this;
+            ++*this;
+            return current;
+        }
+
+        ConstIterator &operator--() {
+            checkIsNotBegin();
+            this->current = this->current == npos ? list->tail : list->linkAt(this->current).prev;
+            return *this;
+        }
+
+        ConstIterator operator--(int) {
+            const auto current = *this;
+            --*this;
+            return current;
+        }
+
+        ConstIterator operator+(difference_type d) const {
+            auto copy = *this;
+            for (difference_type i = 0; i < d; ++i, ++copy);
+            return copy;
+        }
+
+        ConstIterator operator-(difference_type d) const {
+            auto copy = *this;
+            for (difference_type i = 0; i < d; ++i, --copy);
+            return copy;
+        }
+
+        bool operator==(const ConstIterator &other) const {
+            return this->current == other.current;
+        }
+
+        bool operator!=(const ConstIterator &other) const {
+            return !(*this == other);
+        }
+
+    private:
+        index_type current;
+        const VectorBackedList *list;
+
+        void checkIsNotEnd() const {
+            if (this->current == npos) {
+                throw std::out_of_range("Iterator is out of range");
+            }
+        }
+
+        void checkIsNotBegin() const {
+            if (this->current == list->head) {
+                throw std::out_of_range("Iterator is out of range");
+            }
+        }
+    };
+
+    template<typename Type, typename Allocator>
+    class VectorBackedList<Type, Allocator>::Iterator : public VectorBackedList<Type, Allocator>::ConstIterator {
+    public:
+        using pointer = typename VectorBackedList::pointer;
+        using reference = typename VectorBackedList::reference;
+
+        explicit Iterator(index_type current, const VectorBackedList &list) : ConstIterator(current, list) {}
+
+        Iterator(const ConstIterator &other) : ConstIterator(other) {}
+
+        Iterator &operator++() {
+            ConstIterator::operator++();
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            auto result = *this;
+            ConstIterator::operator++();
+            return result;
+        }
+
+        Iterator &operator--() {
+            ConstIterator::operator--();
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            auto result = *this;
+            ConstIterator::operator--();
+            return result;
+        }
+
+        Iterator operator+(difference_type d) const {
+            return ConstIterator::operator+(d);
+        }
+
+        Iterator operator-(difference_type d) const {
+            return ConstIterator::operator-(d);
+        }
+
+        reference operator*() const {
+            // ugly cast, yet reduces code duplication.
+            return const_cast<reference>(ConstIterator::operator*());
+        }
+    };
+
+}
+
+#endif // AISDI_LINEAR_VECTORBACKEDLIST_H
@@ -1,10 +1,22 @@
 #include <string>
 #include <iostream>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <ctime>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
 
 #include "Vector.h"
 #include "LinkedList.h"
+#include "UnrolledLinkedList.h"
+#include "CircularVector.h"
+#include "SegmentedVector.h"
+#include "ConcurrentQueue.h"
+#include "ConcurrentVector.h"
+#include "SpscRing.h"
 
 using namespace aisdi;
 
@@ -28,29 +40,53 @@ void fillVector(Vector<int> &vector, int elements) {
     }
 }
 
+void fillUnrolledList(UnrolledLinkedList<int> &unrolledList, int elements) {
+    for (int i = 0; i < elements; ++i) {
+        unrolledList.append(i);
+    }
+}
+
+void fillCircularVector(CircularVector<int> &circularVector, int elements) {
+    for (int i = 0; i < elements; ++i) {
+        circularVector.append(i);
+    }
+}
+
 
 struct statistics {
     long long vectorTime;
     long long linkedListTime;
+    long long unrolledListTime;
+    long long circularVectorTime;
 
-    statistics(long long int vectorTime, long long int linkedListTime) : vectorTime(vectorTime),
-                                                                         linkedListTime(linkedListTime) {}
+    statistics(long long int vectorTime, long long int linkedListTime, long long int unrolledListTime,
+               long long int circularVectorTime)
+            : vectorTime(vectorTime), linkedListTime(linkedListTime), unrolledListTime(unrolledListTime),
+              circularVectorTime(circularVectorTime) {}
 };
 
 void printTime(const statistics &statistics, int elements) {
     std::cout << "Vector time: " << statistics.vectorTime << ", Linked list time: "
-              << statistics.linkedListTime << ", Elements: " << elements << std::endl;
+              << statistics.linkedListTime << ", Unrolled list time: " << statistics.unrolledListTime
+              << ", Circular vector time: " << statistics.circularVectorTime << ", Elements: " << elements << std::endl;
 }
 
-template<typename VectorFunc, typename LinkedListFunc>
-void performMeasureTime(VectorFunc vectorF, LinkedListFunc linkedListF, int elements) {
+template<typename VectorFunc, typename LinkedListFunc, typename UnrolledListFunc, typename CircularVectorFunc>
+void performMeasureTime(VectorFunc vectorF, LinkedListFunc linkedListF, UnrolledListFunc unrolledListF,
+                        CircularVectorFunc circularVectorF, int elements) {
         Vector<int> vector;
         LinkedList<int> linkedList;
+        UnrolledLinkedList<int> unrolledList;
+        CircularVector<int> circularVector;
 
         fillVector(vector, elements);
         fillLinkedList(linkedList, elements);
+        fillUnrolledList(unrolledList, elements);
+        fillCircularVector(circularVector, elements);
         const statistics &statistics = {measureTime([&]() -> void { vectorF(vector); }),
-                                        measureTime([&]() -> void { linkedListF(linkedList); })};
+                                        measureTime([&]() -> void { linkedListF(linkedList); }),
+                                        measureTime([&]() -> void { unrolledListF(unrolledList); }),
+                                        measureTime([&]() -> void { circularVectorF(circularVector); })};
         printTime(statistics, elements);
 }
 
@@ -60,6 +96,8 @@ void testBegin(Vector<int> elements) {
         performMeasureTime(
                 [&](Vector<int> &vector) -> void { vector.prepend(1); },
                 [&](LinkedList<int> &linkedList) -> void { linkedList.prepend(1); },
+                [&](UnrolledLinkedList<int> &unrolledList) -> void { unrolledList.prepend(1); },
+                [&](CircularVector<int> &circularVector) -> void { circularVector.prepend(1); },
                 i
         );
     }
@@ -73,6 +111,8 @@ void testEnd(Vector<int> elements) {
         performMeasureTime(
                 [&](Vector<int> &vector) -> void { vector.append(1); },
                 [&](LinkedList<int> &linkedList) -> void { linkedList.append(1); },
+                [&](UnrolledLinkedList<int> &unrolledList) -> void { unrolledList.append(1); },
+                [&](CircularVector<int> &circularVector) -> void { circularVector.append(1); },
                 i
         );
     }
@@ -85,6 +125,8 @@ void testGetFirst(Vector<int> elements) {
         performMeasureTime(
                 [&](Vector<int> &vector) -> void { *(vector.begin()); },
                 [&](LinkedList<int> &linkedList) -> void { *(linkedList.begin()); },
+                [&](UnrolledLinkedList<int> &unrolledList) -> void { *(unrolledList.begin()); },
+                [&](CircularVector<int> &circularVector) -> void { *(circularVector.begin()); },
                 i
         );
     }
@@ -97,6 +139,8 @@ void testGetLast(Vector<int> elements) {
         performMeasureTime(
                 [&](Vector<int> &vector) -> void { *(--vector.end()); },
                 [&](LinkedList<int> &linkedList) -> void { *(--linkedList.end()); },
+                [&](UnrolledLinkedList<int> &unrolledList) -> void { *(--unrolledList.end()); },
+                [&](CircularVector<int> &circularVector) -> void { *(--circularVector.end()); },
                 i
         );
     }
@@ -109,12 +153,278 @@ void testGetMiddle(Vector<int> elements) {
         performMeasureTime(
                 [&](Vector<int> &vector) -> void { *(vector.begin() + i / 2); },
                 [&](LinkedList<int> &linkedList) -> void { *(linkedList.begin() + i / 2); },
+                [&](UnrolledLinkedList<int> &unrolledList) -> void { *(unrolledList.begin() + i / 2); },
+                [&](CircularVector<int> &circularVector) -> void { *(circularVector.begin() + i / 2); },
                 i
         );
     }
     std::cout << "<<End get middle>>" << std::endl;
 }
 
+void testInsertMiddle(Vector<int> elements) {
+    std::cout << "<<Measure insert middle>>" << std::endl;
+    for (const auto i: elements) {
+        performMeasureTime(
+                [&](Vector<int> &vector) -> void { vector.insert(vector.begin() + i / 2, 1); },
+                [&](LinkedList<int> &linkedList) -> void { linkedList.insert(linkedList.begin() + i / 2, 1); },
+                [&](UnrolledLinkedList<int> &unrolledList) -> void {
+                    unrolledList.insert(unrolledList.begin() + i / 2, 1);
+                },
+                [&](CircularVector<int> &circularVector) -> void {
+                    circularVector.insert(circularVector.begin() + i / 2, 1);
+                },
+                i
+        );
+    }
+    std::cout << "<<End insert middle>>" << std::endl;
+}
+
+void testTraverse(Vector<int> elements) {
+    std::cout << "<<Measure traverse>>" << std::endl;
+    long long sum = 0;
+    for (const auto i: elements) {
+        performMeasureTime(
+                [&](Vector<int> &vector) -> void { for (const auto value: vector) sum += value; },
+                [&](LinkedList<int> &linkedList) -> void { for (const auto value: linkedList) sum += value; },
+                [&](UnrolledLinkedList<int> &unrolledList) -> void {
+                    for (const auto value: unrolledList) sum += value;
+                },
+                [&](CircularVector<int> &circularVector) -> void {
+                    for (const auto value: circularVector) sum += value;
+                },
+                i
+        );
+    }
+    std::cout << "<<End traverse>> (" << sum << ")" << std::endl;
+}
+
+void testSort(Vector<int> elements) {
+    std::cout << "<<Measure sort>>" << std::endl;
+    for (const auto i: elements) {
+        std::mt19937 generator(static_cast<unsigned>(i));
+        Vector<int> vector;
+        LinkedList<int> linkedList;
+        for (int j = 0; j < i; ++j) {
+            const auto value = static_cast<int>(generator());
+            vector.append(value);
+            linkedList.append(value);
+        }
+        Vector<int> stableVector(vector);
+        Vector<int> radixVector(vector);
+
+        const auto vectorTime = measureTime([&]() -> void { vector.sort(); });
+        const auto stableVectorTime = measureTime([&]() -> void { stableVector.stableSort(); });
+        const auto radixVectorTime = measureTime([&]() -> void { radixVector.radixSort(); });
+        const auto linkedListTime = measureTime([&]() -> void { linkedList.sort(); });
+        std::cout << "Vector time: " << vectorTime << ", Vector stable time: " << stableVectorTime
+                  << ", Vector radix time: " << radixVectorTime << ", Linked list time: " << linkedListTime
+                  << ", Elements: " << i << std::endl;
+    }
+    std::cout << "<<End sort>>" << std::endl;
+}
+
+void testGrow(Vector<int> elements) {
+    std::cout << "<<Measure grow and traverse>>" << std::endl;
+    long long sum = 0;
+    for (const auto i: elements) {
+        Vector<int> vector;
+        SegmentedVector<int> segmentedVector;
+        const auto vectorGrowTime = measureTime([&]() -> void { fillVector(vector, i); });
+        const auto segmentedGrowTime = measureTime([&]() -> void {
+            for (int j = 0; j < i; ++j) {
+                segmentedVector.append(j);
+            }
+        });
+        const auto vectorTraverseTime = measureTime([&]() -> void { for (const auto value: vector) sum += value; });
+        const auto segmentedTraverseTime = measureTime([&]() -> void {
+            for (const auto value: segmentedVector) sum += value;
+        });
+        std::cout << "Vector grow time: " << vectorGrowTime << ", Segmented vector grow time: " << segmentedGrowTime
+                  << ", Vector traverse time: " << vectorTraverseTime << ", Segmented vector traverse time: "
+                  << segmentedTraverseTime << ", Elements: " << i << std::endl;
+    }
+    std::cout << "<<End grow and traverse>> (" << sum << ")" << std::endl;
+}
+
+// Wall time in milliseconds of producers pushing itemsPerProducer items each while as many consumers pop them.
+template<typename Push, typename TryPop>
+long long measureQueueThroughput(int threadPairs, int itemsPerProducer, Push push, TryPop tryPop) {
+    std::atomic<int> popped(0);
+    const int total = threadPairs * itemsPerProducer;
+    std::vector<std::thread> threads;
+    const auto start = std::chrono::steady_clock::now();
+    for (int t = 0; t < threadPairs; ++t) {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < itemsPerProducer; ++i) {
+                push(i);
+            }
+        });
+        threads.emplace_back([&]() {
+            while (popped.load(std::memory_order_relaxed) < total) {
+                if (tryPop()) {
+                    popped.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+    for (auto &thread: threads) {
+        thread.join();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+}
+
+void testConcurrentQueue(Vector<int> threadPairCounts) {
+    std::cout << "<<Measure concurrent queue>>" << std::endl;
+    const int itemsPerProducer = 200000;
+    for (const auto threadPairs: threadPairCounts) {
+        ConcurrentQueue<int> queue;
+        const auto queueTime = measureQueueThroughput(
+                threadPairs, itemsPerProducer,
+                [&](int item) -> void { queue.push(item); },
+                [&]() -> bool {
+                    int item;
+                    return queue.tryPop(item);
+                });
+
+        LinkedList<int> linkedList;
+        std::mutex mutex;
+        const auto lockedListTime = measureQueueThroughput(
+                threadPairs, itemsPerProducer,
+                [&](int item) -> void {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    linkedList.append(item);
+                },
+                [&]() -> bool {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (linkedList.isEmpty()) {
+                        return false;
+                    }
+                    linkedList.popFirst();
+                    return true;
+                });
+
+        std::cout << "Concurrent queue time [ms]: " << queueTime << ", Locked linked list time [ms]: "
+                  << lockedListTime << ", Threads: " << 2 * threadPairs << ", Elements: "
+                  << threadPairs * itemsPerProducer << std::endl;
+    }
+    std::cout << "<<End concurrent queue>>" << std::endl;
+}
+
+template<typename Append>
+long long measureAppendThroughput(int threadCount, int itemsPerThread, Append append) {
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < itemsPerThread; ++i) {
+                append(t * itemsPerThread + i);
+            }
+        });
+    }
+    for (auto &thread: threads) {
+        thread.join();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+}
+
+void testConcurrentVector(Vector<int> threadCounts) {
+    std::cout << "<<Measure concurrent vector>>" << std::endl;
+    const int itemsPerThread = 500000;
+    for (const auto threadCount: threadCounts) {
+        ConcurrentVector<int> concurrentVector;
+        const auto concurrentTime = measureAppendThroughput(
+                threadCount, itemsPerThread, [&](int item) -> void { concurrentVector.append(item); });
+
+        Vector<int> vector;
+        std::mutex mutex;
+        const auto lockedVectorTime = measureAppendThroughput(
+                threadCount, itemsPerThread, [&](int item) -> void {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    vector.append(item);
+                });
+
+        std::cout << "Concurrent vector time [ms]: " << concurrentTime << ", Locked vector time [ms]: "
+                  << lockedVectorTime << ", Threads: " << threadCount << ", Elements: "
+                  << threadCount * itemsPerThread << std::endl;
+    }
+    std::cout << "<<End concurrent vector>>" << std::endl;
+}
+
+template<typename Produce, typename Consume>
+long long measureHopThroughput(int total, Produce produce, Consume consume) {
+    const auto start = std::chrono::steady_clock::now();
+    std::thread producer([&]() {
+        for (int next = 0; next < total;) {
+            const int pushed = produce(next, std::min(next + 64, total));
+            if (pushed == 0) {
+                std::this_thread::yield();
+            }
+            next += pushed;
+        }
+    });
+    for (int received = 0; received < total;) {
+        const int popped = consume();
+        if (popped == 0) {
+            std::this_thread::yield();
+        }
+        received += popped;
+    }
+    producer.join();
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+}
+
+void testSpscRing(Vector<int> elements) {
+    std::cout << "<<Measure SPSC ring>>" << std::endl;
+    for (const auto total: elements) {
+        SpscRing<int> ring(1024);
+        int item;
+        const auto ringTime = measureHopThroughput(
+                total,
+                [&](int first, int) -> int { return ring.tryPush(first) ? 1 : 0; },
+                [&]() -> int { return ring.tryPop(item) ? 1 : 0; });
+
+        int batch[64];
+        const auto batchTime = measureHopThroughput(
+                total,
+                [&](int first, int last) -> int {
+                    for (int i = first; i < last; ++i) {
+                        batch[i - first] = i;
+                    }
+                    return static_cast<int>(ring.pushBatch(batch, batch + (last - first)));
+                },
+                [&]() -> int {
+                    int popped[64];
+                    return static_cast<int>(ring.popBatch(popped, 64));
+                });
+
+        LinkedList<int> linkedList;
+        std::mutex mutex;
+        const auto lockedListTime = measureHopThroughput(
+                total,
+                [&](int first, int) -> int {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    linkedList.append(first);
+                    return 1;
+                },
+                [&]() -> int {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (linkedList.isEmpty()) {
+                        return 0;
+                    }
+                    linkedList.popFirst();
+                    return 1;
+                });
+
+        std::cout << "SPSC ring time [ms]: " << ringTime << ", SPSC ring batched time [ms]: " << batchTime
+                  << ", Locked linked list time [ms]: " << lockedListTime << ", Elements: " << total
+                  << std::endl;
+    }
+    std::cout << "<<End SPSC ring>>" << std::endl;
+}
+
 int main() {
     Vector<int> elements{10000, 100000, 1000000};
     testBegin(elements);
@@ -122,6 +432,13 @@ int main() {
     testGetFirst(elements);
     testGetLast(elements);
     testGetMiddle(elements);
+    testInsertMiddle(elements);
+    testTraverse(elements);
+    testSort(elements);
+    testGrow(elements);
+    testConcurrentQueue({1, 2, 4, 16});
+    testConcurrentVector({1, 2, 4, 16});
+    testSpscRing(elements);
     return 0;
 }
 
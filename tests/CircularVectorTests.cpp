@@ -0,0 +1,182 @@
+#include <CircularVector.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <initializer_list>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+namespace
+{
+
+template <typename Collection>
+void thenCollectionContainsValues(const Collection& collection, std::initializer_list<int> expected)
+{
+  BOOST_CHECK_EQUAL_COLLECTIONS(collection.begin(), collection.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(collection.getSize(), expected.size());
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(CircularVectorTests)
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollection_WhenUsedAsQueue_ThenItemsComeOutInOrderWithoutGrowing)
+{
+  aisdi::CircularVector<int> collection;
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK_EQUAL(collection.getCapacity(), 0u);
+
+  for (int i = 0; i < 4; ++i)
+    collection.append(i);
+  for (int i = 4; i < 1000; ++i)
+  {
+    collection.append(i);
+    BOOST_CHECK_EQUAL(collection.popFirst(), i - 4);
+  }
+
+  BOOST_CHECK_EQUAL(collection.getCapacity(), 8u);
+  thenCollectionContainsValues(collection, { 996, 997, 998, 999 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenWrappedCollection_WhenAccessingByIndex_ThenItemsAreFound)
+{
+  aisdi::CircularVector<int> collection = { 3, 4, 5 };
+  collection.prepend(2);
+  collection.prepend(1);
+  collection.prepend(0);
+
+  thenCollectionContainsValues(collection, { 0, 1, 2, 3, 4, 5 });
+  BOOST_CHECK_EQUAL(collection[0], 0);
+  BOOST_CHECK_EQUAL(collection.at(5), 5);
+  BOOST_CHECK_THROW(collection.at(6), std::out_of_range);
+  BOOST_CHECK_EQUAL(*(collection.begin() + 4), 4);
+  BOOST_CHECK_EQUAL(collection.begin()[2], 2);
+  BOOST_CHECK_EQUAL(collection.end() - collection.begin(), 6);
+  BOOST_CHECK_EQUAL(*(collection.end() - 1), 5);
+  BOOST_CHECK_THROW(*collection.end(), std::out_of_range);
+  BOOST_CHECK_THROW(--collection.begin(), std::out_of_range);
+  BOOST_CHECK_EQUAL(collection.popLast(), 5);
+  BOOST_CHECK_EQUAL(collection.popFirst(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenWrappedCollection_WhenInsertingAndErasingInside_ThenOrderIsKept)
+{
+  aisdi::CircularVector<std::string> collection = { "c", "d", "e", "f" };
+  collection.prepend("b");
+  collection.insert(collection.begin() + 1, "x");
+  collection.insert(collection.end() - 1, "y");
+  collection.erase(collection.begin() + 2);
+  collection.erase(collection.begin() + 3, collection.end() - 1);
+
+  const std::initializer_list<std::string> expected = { "b", "x", "d", "f" };
+  BOOST_CHECK_EQUAL_COLLECTIONS(collection.begin(), collection.end(), expected.begin(), expected.end());
+  BOOST_CHECK_THROW(collection.erase(collection.end()), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCopyingAndMoving_ThenContentsFollow)
+{
+  aisdi::CircularVector<std::unique_ptr<int>> pointers;
+  pointers.append(std::make_unique<int>(2));
+  pointers.prepend(std::make_unique<int>(1));
+  aisdi::CircularVector<std::unique_ptr<int>> moved{std::move(pointers)};
+  BOOST_CHECK(pointers.isEmpty());
+  BOOST_CHECK_EQUAL(*moved[0], 1);
+
+  aisdi::CircularVector<int> collection = { 2, 3 };
+  collection.prepend(1);
+  aisdi::CircularVector<int> copy{collection};
+  copy.append(4);
+  collection = copy;
+  copy = std::move(collection);
+
+  thenCollectionContainsValues(copy, { 1, 2, 3, 4 });
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK_THROW(collection.popFirst(), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenEveryWrapOffset_WhenErasingAndInsertingAnyRange_ThenContentsMatch)
+{
+  for (std::size_t offset = 0; offset < 16; ++offset)
+    for (std::size_t first = 0; first <= 13; ++first)
+      for (std::size_t last = first; last <= 13; ++last)
+      {
+        aisdi::CircularVector<int> collection;
+        collection.reserve(16);
+        for (std::size_t i = 0; i < offset; ++i)
+        {
+          collection.append(-1);
+          collection.popFirst();
+        }
+        for (int i = 0; i < 13; ++i)
+          collection.append(i);
+        std::deque<int> expected(collection.begin(), collection.end());
+
+        collection.erase(collection.begin() + first, collection.begin() + last);
+        expected.erase(expected.begin() + first, expected.begin() + last);
+        collection.insert(collection.begin() + first / 2, 100);
+        expected.insert(expected.begin() + first / 2, 100);
+
+        BOOST_REQUIRE(std::equal(collection.begin(), collection.end(), expected.begin(), expected.end()));
+        BOOST_REQUIRE_EQUAL(collection.getCapacity(), 16u);
+      }
+}
+
+BOOST_AUTO_TEST_CASE(GivenRandomOperations_WhenComparedWithDeque_ThenContentsMatch)
+{
+  std::mt19937 generator(21);
+  aisdi::CircularVector<int> collection;
+  std::deque<int> expected;
+
+  for (int step = 0; step < 5000; ++step)
+  {
+    const std::size_t position = expected.empty() ? 0 : generator() % (expected.size() + 1);
+    const int operation = generator() % 6;
+    if (operation == 0 || expected.empty())
+    {
+      collection.append(step);
+      expected.push_back(step);
+    }
+    else if (operation == 1)
+    {
+      collection.prepend(step);
+      expected.push_front(step);
+    }
+    else if (operation == 2)
+    {
+      collection.insert(collection.begin() + position, step);
+      expected.insert(expected.begin() + position, step);
+    }
+    else if (operation == 3)
+    {
+      const std::size_t erased = std::min<std::size_t>(generator() % 4, expected.size() - position);
+      collection.erase(collection.begin() + position, collection.begin() + (position + erased));
+      expected.erase(expected.begin() + position, expected.begin() + (position + erased));
+    }
+    else if (operation == 4)
+    {
+      BOOST_REQUIRE_EQUAL(collection.popFirst(), expected.front());
+      expected.pop_front();
+    }
+    else
+    {
+      BOOST_REQUIRE_EQUAL(collection.popLast(), expected.back());
+      expected.pop_back();
+    }
+
+    if (!expected.empty())
+    {
+      const std::size_t probe = generator() % expected.size();
+      BOOST_REQUIRE_EQUAL(collection[probe], expected[probe]);
+    }
+  }
+
+  BOOST_CHECK_EQUAL_COLLECTIONS(collection.begin(), collection.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,153 @@
+#include <ConcurrentQueue.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+BOOST_AUTO_TEST_SUITE(ConcurrentQueueTests)
+
+BOOST_AUTO_TEST_CASE(GivenEmptyQueue_WhenPushingAndPopping_ThenItemsComeOutInOrder)
+{
+  aisdi::ConcurrentQueue<std::string> queue;
+  std::string item;
+  BOOST_CHECK(queue.isEmpty());
+  BOOST_CHECK(!queue.tryPop(item));
+
+  queue.push("a");
+  queue.emplace(2, 'b');
+  BOOST_CHECK(!queue.isEmpty());
+  BOOST_CHECK(queue.tryPop(item));
+  BOOST_CHECK_EQUAL(item, "a");
+  BOOST_CHECK(queue.tryPop(item));
+  BOOST_CHECK_EQUAL(item, "bb");
+  BOOST_CHECK(!queue.tryPop(item));
+  BOOST_CHECK(queue.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenQueue_WhenPushingRangeAndPoppingBatch_ThenBatchesKeepOrder)
+{
+  aisdi::ConcurrentQueue<int> queue;
+  const std::vector<int> values = { 1, 2, 3, 4, 5 };
+  queue.push(0);
+  queue.pushRange(values.begin(), values.end());
+  queue.pushRange(values.end(), values.end());
+
+  std::vector<int> popped;
+  BOOST_CHECK_EQUAL(queue.popBatch(std::back_inserter(popped), 4), 4u);
+  BOOST_CHECK_EQUAL(queue.popBatch(std::back_inserter(popped), 4), 2u);
+  BOOST_CHECK_EQUAL(queue.popBatch(std::back_inserter(popped), 4), 0u);
+
+  const std::vector<int> expected = { 0, 1, 2, 3, 4, 5 };
+  BOOST_CHECK_EQUAL_COLLECTIONS(popped.begin(), popped.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenItemsWithoutDefaultConstructor_WhenPoppingBatch_ThenTheyAreMovedOut)
+{
+  struct Item
+  {
+    explicit Item(int value_) : value(value_) {}
+
+    int value;
+  };
+  static_assert(!std::is_default_constructible<Item>::value, "the test needs a type without a default constructor");
+
+  aisdi::ConcurrentQueue<Item> queue;
+  for (int i = 0; i < 3; ++i)
+    queue.emplace(i);
+
+  std::vector<Item> popped;
+  BOOST_CHECK_EQUAL(queue.popBatch(std::back_inserter(popped), 2), 2u);
+  Item item{-1};
+  BOOST_CHECK(queue.tryPop(item));
+  BOOST_CHECK(!queue.tryPop(item));
+
+  BOOST_REQUIRE_EQUAL(popped.size(), 2u);
+  BOOST_CHECK_EQUAL(popped[0].value, 0);
+  BOOST_CHECK_EQUAL(popped[1].value, 1);
+  BOOST_CHECK_EQUAL(item.value, 2);
+}
+
+BOOST_AUTO_TEST_CASE(GivenQueueWithItems_WhenDestroyed_ThenItemsAreReleased)
+{
+  const auto shared = std::make_shared<int>(7);
+  {
+    aisdi::ConcurrentQueue<std::shared_ptr<int>> queue;
+    for (int i = 0; i < 200; ++i)
+      queue.push(shared);
+    std::shared_ptr<int> item;
+    for (int i = 0; i < 150; ++i)
+      queue.tryPop(item);
+    BOOST_CHECK_EQUAL(shared.use_count(), 52);
+  }
+  BOOST_CHECK_EQUAL(shared.use_count(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(GivenManyProducersAndConsumers_WhenRunningConcurrently_ThenEveryItemIsPoppedOnceInProducerOrder)
+{
+  constexpr int producers = 4;
+  constexpr int consumers = 4;
+  constexpr int itemsPerProducer = 20000;
+  aisdi::ConcurrentQueue<std::pair<int, int>> queue;
+  std::atomic<int> poppedCount(0);
+  std::vector<std::vector<std::pair<int, int>>> popped(consumers);
+
+  std::vector<std::thread> threads;
+  for (int producer = 0; producer < producers; ++producer)
+    threads.emplace_back([&queue, producer] {
+      for (int i = 0; i < itemsPerProducer; i += 2)
+      {
+        if (i % 100 == 0)
+        {
+          const std::pair<int, int> pair[] = { { producer, i }, { producer, i + 1 } };
+          queue.pushRange(std::begin(pair), std::end(pair));
+        }
+        else
+        {
+          queue.push({ producer, i });
+          queue.push({ producer, i + 1 });
+        }
+      }
+    });
+  for (int consumer = 0; consumer < consumers; ++consumer)
+    threads.emplace_back([&, consumer] {
+      while (poppedCount.load() < producers * itemsPerProducer)
+      {
+        std::pair<int, int> item;
+        if (consumer % 2 == 0 && queue.tryPop(item))
+        {
+          popped[consumer].push_back(item);
+          ++poppedCount;
+        }
+        else if (consumer % 2 == 1)
+          poppedCount += static_cast<int>(queue.popBatch(std::back_inserter(popped[consumer]), 8));
+      }
+    });
+  for (auto& thread : threads)
+    thread.join();
+
+  std::vector<std::vector<int>> seen(producers, std::vector<int>(itemsPerProducer, 0));
+  for (const auto& items : popped)
+  {
+    std::vector<int> last(producers, -1);
+    for (const auto& item : items)
+    {
+      BOOST_REQUIRE_GT(item.second, last[item.first]);
+      last[item.first] = item.second;
+      ++seen[item.first][item.second];
+    }
+  }
+  for (const auto& counts : seen)
+    BOOST_CHECK(std::all_of(counts.begin(), counts.end(), [](int count) { return count == 1; }));
+  BOOST_CHECK(queue.isEmpty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,267 @@
+#include <ConcurrentVector.h>
+
+#include <algorithm>
+#include <atomic>
+#include <csignal>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__unix__)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+namespace
+{
+
+struct AllocationFailures
+{
+  AllocationFailures(int count, bool released_)
+    : left(count), entered(false), released(released_)
+  {}
+
+  std::atomic<int> left;
+  std::atomic<bool> entered;
+  std::atomic<bool> released;
+};
+
+// Fails the given number of allocations, each one only once it is released.
+template <typename T>
+class FailingAllocator
+{
+public:
+  using value_type = T;
+
+  explicit FailingAllocator(AllocationFailures& failures_)
+    : failures(&failures_)
+  {}
+
+  template <typename U>
+  FailingAllocator(const FailingAllocator<U>& other)
+    : failures(other.failures)
+  {}
+
+  T* allocate(std::size_t n)
+  {
+    if (failures->left.load() > 0)
+    {
+      failures->entered.store(true);
+      while (!failures->released.load())
+        std::this_thread::yield();
+      failures->left.fetch_sub(1);
+      throw std::bad_alloc();
+    }
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T* p, std::size_t n)
+  {
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  template <typename U>
+  bool operator==(const FailingAllocator<U>& other) const
+  {
+    return failures == other.failures;
+  }
+
+  template <typename U>
+  bool operator!=(const FailingAllocator<U>& other) const
+  {
+    return !(*this == other);
+  }
+
+  AllocationFailures* failures;
+};
+
+using FailingVector = aisdi::ConcurrentVector<int, FailingAllocator<int>>;
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(ConcurrentVectorTests)
+
+BOOST_AUTO_TEST_CASE(GivenEmptyVector_WhenAppending_ThenItemsAreReadableInOrder)
+{
+  aisdi::ConcurrentVector<std::string> vector;
+  BOOST_CHECK(vector.isEmpty());
+  BOOST_CHECK(vector.begin() == vector.end());
+  BOOST_CHECK_THROW(vector.at(0), std::out_of_range);
+
+  BOOST_CHECK_EQUAL(vector.append("a"), 0u);
+  BOOST_CHECK_EQUAL(vector.emplaceAppend(2, 'b'), 1u);
+  const std::string c = "c";
+  BOOST_CHECK_EQUAL(vector.append(c), 2u);
+
+  BOOST_CHECK_EQUAL(vector.getSize(), 3u);
+  BOOST_CHECK_EQUAL(vector[1], "bb");
+  BOOST_CHECK_EQUAL(vector.at(2), "c");
+  BOOST_CHECK_THROW(vector.at(3), std::out_of_range);
+  const std::vector<std::string> expected = { "a", "bb", "c" };
+  BOOST_CHECK_EQUAL_COLLECTIONS(vector.begin(), vector.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenVector_WhenAppendingAcrossSegments_ThenAddressesStayStable)
+{
+  aisdi::ConcurrentVector<int> vector;
+  vector.append(0);
+  const int *first = &vector[0];
+  for (int i = 1; i < 10000; ++i)
+    vector.append(i);
+
+  BOOST_CHECK_EQUAL(first, &vector[0]);
+  BOOST_CHECK_EQUAL(vector.getSize(), 10000u);
+  for (int i = 0; i < 10000; ++i)
+    BOOST_CHECK_EQUAL(vector[i], i);
+  BOOST_CHECK_EQUAL(vector.end() - vector.begin(), 10000);
+  BOOST_CHECK(std::equal(vector.begin(), vector.end(), vector.begin()));
+  BOOST_CHECK_EQUAL(*(vector.begin() + 5000), 5000);
+  BOOST_CHECK_EQUAL(*(vector.end() - 1), 9999);
+}
+
+BOOST_AUTO_TEST_CASE(GivenVector_WhenAppendingRange_ThenRunIsContiguous)
+{
+  aisdi::ConcurrentVector<std::string> vector;
+  vector.reserve(100);
+  vector.append("x");
+  std::vector<std::string> values;
+  for (int i = 0; i < 300; ++i)
+    values.push_back(std::to_string(i));
+
+  BOOST_CHECK_EQUAL(vector.appendRange(values.begin(), values.end()), 1u);
+  BOOST_CHECK_EQUAL(vector.appendRange(values.end(), values.end()), 301u);
+  BOOST_CHECK_EQUAL(vector.getSize(), 301u);
+  BOOST_CHECK(std::equal(values.begin(), values.end(), vector.begin() + 1));
+}
+
+BOOST_AUTO_TEST_CASE(GivenVectorWithItems_WhenDestroyed_ThenItemsAreReleased)
+{
+  const auto shared = std::make_shared<int>(7);
+  {
+    aisdi::ConcurrentVector<std::shared_ptr<int>> vector;
+    for (int i = 0; i < 200; ++i)
+      vector.append(shared);
+    BOOST_CHECK_EQUAL(shared.use_count(), 201);
+  }
+  BOOST_CHECK_EQUAL(shared.use_count(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(GivenManyAppendersAndReaders_WhenRunningConcurrently_ThenPrefixIsAlwaysComplete)
+{
+  const int threadCount = 4;
+  const int itemsPerThread = 20000;
+  aisdi::ConcurrentVector<int> vector;
+  std::atomic<bool> done(false);
+  std::atomic<bool> prefixBroken(false);
+
+  std::thread reader([&]() {
+    while (!done.load()) {
+      for (const int item: vector)
+        if (item < 0 || item >= threadCount * itemsPerThread)
+          prefixBroken.store(true);
+    }
+  });
+
+  std::vector<std::vector<std::size_t>> runStarts(threadCount);
+  std::vector<std::thread> appenders;
+  for (int t = 0; t < threadCount; ++t)
+    appenders.emplace_back([&, t]() {
+      for (int i = 0; i < itemsPerThread; i += 10) {
+        if (i % 20 == 0) {
+          for (int j = i; j < i + 10; ++j)
+            vector.append(t * itemsPerThread + j);
+        } else {
+          std::vector<int> run;
+          for (int j = i; j < i + 10; ++j)
+            run.push_back(t * itemsPerThread + j);
+          runStarts[t].push_back(vector.appendRange(run.begin(), run.end()));
+        }
+      }
+    });
+  for (auto &appender: appenders)
+    appender.join();
+  done.store(true);
+  reader.join();
+
+  BOOST_CHECK(!prefixBroken.load());
+  BOOST_REQUIRE_EQUAL(vector.getSize(), std::size_t(threadCount * itemsPerThread));
+  for (const auto &starts: runStarts)
+    for (const auto first: starts)
+      for (std::size_t j = 1; j < 10; ++j)
+        BOOST_REQUIRE_EQUAL(vector[first + j], vector[first] + int(j));
+  std::vector<int> items(vector.begin(), vector.end());
+  std::sort(items.begin(), items.end());
+  for (int i = 0; i < threadCount * itemsPerThread; ++i)
+    BOOST_REQUIRE_EQUAL(items[i], i);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSegmentFailingToAllocate_WhenReserving_ThenBadAllocIsThrownAndLaterAppendsWork)
+{
+  AllocationFailures failures(1, true);
+  FailingVector vector{FailingAllocator<int>(failures)};
+
+  BOOST_CHECK_THROW(vector.reserve(10), std::bad_alloc);
+  vector.reserve(10);
+  BOOST_CHECK_EQUAL(vector.append(5), 0u);
+  BOOST_CHECK_EQUAL(vector.at(0), 5);
+}
+
+BOOST_AUTO_TEST_CASE(GivenAllocationFailingInAnotherThread_WhenWaitingForSegment_ThenWaiterAllocatesIt)
+{
+  AllocationFailures failures(1, false);
+  FailingVector vector{FailingAllocator<int>(failures)};
+
+  bool failed = false;
+  std::thread allocating([&]() {
+    try
+    {
+      vector.reserve(1);
+    }
+    catch (const std::bad_alloc&)
+    {
+      failed = true;
+    }
+  });
+  while (!failures.entered.load())
+    std::this_thread::yield();
+  std::thread waiting([&]() { vector.append(1); });
+  failures.released.store(true);
+  allocating.join();
+  waiting.join();
+
+  BOOST_CHECK(failed);
+  BOOST_CHECK_EQUAL(vector.getSize(), 1u);
+  BOOST_CHECK_EQUAL(vector[0], 1);
+}
+
+#if defined(__unix__)
+BOOST_AUTO_TEST_CASE(GivenSegmentFailingToAllocate_WhenAppending_ThenProgramTerminates)
+{
+  const pid_t child = fork();
+  BOOST_REQUIRE(child >= 0);
+  if (child == 0)
+  {
+    // the test runner's own handler would report the abort as a failure of the child.
+    std::signal(SIGABRT, SIG_DFL);
+    std::freopen("/dev/null", "w", stderr);
+    AllocationFailures failures(1, true);
+    FailingVector vector{FailingAllocator<int>(failures)};
+    vector.append(1);
+    std::_Exit(0);
+  }
+  int status = 0;
+  waitpid(child, &status, 0);
+  BOOST_CHECK(WIFSIGNALED(status) && WTERMSIG(status) == SIGABRT);
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
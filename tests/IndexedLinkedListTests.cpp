@@ -0,0 +1,111 @@
+#include <IndexedLinkedList.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+namespace
+{
+
+template <typename Collection>
+void thenCollectionContainsValues(const Collection& collection, std::initializer_list<int> expected)
+{
+  BOOST_CHECK_EQUAL_COLLECTIONS(collection.begin(), collection.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(collection.getSize(), expected.size());
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(IndexedLinkedListTests)
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenAccessingByIndex_ThenItemsAreFound)
+{
+  aisdi::IndexedLinkedList<int> collection;
+  for (int i = 0; i < 1000; ++i)
+    collection.append(i);
+
+  BOOST_CHECK_EQUAL(collection.at(0), 0);
+  BOOST_CHECK_EQUAL(collection.at(500), 500);
+  BOOST_CHECK_EQUAL(collection.at(999), 999);
+  BOOST_CHECK_THROW(collection.at(1000), std::out_of_range);
+  BOOST_CHECK_EQUAL(*(collection.begin() + 700), 700);
+  BOOST_CHECK_EQUAL(*(collection.end() - 1), 999);
+  BOOST_CHECK_EQUAL(collection.indexOf(collection.begin() + 321), 321);
+  BOOST_CHECK_EQUAL(collection.indexOf(collection.end()), 1000);
+  BOOST_CHECK(collection.begin() + 1000 == collection.end());
+  BOOST_CHECK_THROW(collection.begin() + 1001, std::out_of_range);
+  BOOST_CHECK_THROW(collection.begin() - 1, std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenInsertingAndErasingAtPositions_ThenIndicesFollow)
+{
+  aisdi::IndexedLinkedList<int> collection = { 1, 2, 5 };
+
+  collection.insert(collection.begin() + 2, 4);
+  collection.insert(collection.begin() + 2, 3);
+  collection.prepend(0);
+  collection.erase(collection.begin() + 3);
+
+  thenCollectionContainsValues(collection, { 0, 1, 2, 4, 5 });
+  BOOST_CHECK_EQUAL(collection.at(3), 4);
+  BOOST_CHECK_EQUAL(collection.indexOf(--collection.end()), 4);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenPoppingAndClearing_ThenItStaysConsistent)
+{
+  aisdi::IndexedLinkedList<std::string> collection = { "a", "b", "c", "d" };
+
+  BOOST_CHECK_EQUAL(collection.popFirst(), "a");
+  BOOST_CHECK_EQUAL(collection.popLast(), "d");
+  BOOST_CHECK_EQUAL(collection.at(1), "c");
+
+  aisdi::IndexedLinkedList<std::string> moved{std::move(collection)};
+  collection.append("e");
+  moved.clear();
+  moved.append("f");
+
+  BOOST_CHECK_EQUAL(collection.at(0), "e");
+  BOOST_CHECK_EQUAL(moved.at(0), "f");
+  moved.popFirst();
+  BOOST_CHECK_THROW(moved.popFirst(), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenRandomOperations_WhenComparedWithVector_ThenContentsAndIndicesMatch)
+{
+  std::mt19937 generator(11);
+  aisdi::IndexedLinkedList<int> collection;
+  std::vector<int> expected;
+
+  for (int step = 0; step < 5000; ++step)
+  {
+    const std::size_t position = expected.empty() ? 0 : generator() % (expected.size() + 1);
+    if (generator() % 3 != 0 || expected.empty())
+    {
+      collection.insert(collection.begin() + position, step);
+      expected.insert(expected.begin() + position, step);
+    }
+    else
+    {
+      const std::size_t erased = std::min<std::size_t>(generator() % 4, expected.size() - position);
+      collection.erase(collection.begin() + position, collection.begin() + (position + erased));
+      expected.erase(expected.begin() + position, expected.begin() + (position + erased));
+    }
+
+    if (!expected.empty())
+    {
+      const std::size_t probe = generator() % expected.size();
+      BOOST_REQUIRE_EQUAL(collection.at(probe), expected[probe]);
+      BOOST_REQUIRE_EQUAL(collection.indexOf(collection.begin() + probe), probe);
+    }
+  }
+
+  BOOST_CHECK_EQUAL_COLLECTIONS(collection.begin(), collection.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
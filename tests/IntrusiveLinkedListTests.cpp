@@ -0,0 +1,149 @@
+#include <IntrusiveLinkedList.h>
+
+#include <initializer_list>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+namespace
+{
+
+struct Task
+{
+  Task(int id_ = 0) : id(id_) {}
+
+  std::string name;
+  int id;
+  aisdi::IntrusiveListHook hook;
+};
+
+using TaskList = aisdi::IntrusiveLinkedList<Task, &Task::hook>;
+
+void thenListContainsIds(const TaskList& list, std::initializer_list<int> expected)
+{
+  std::vector<int> ids;
+  for (const auto& task : list)
+    ids.push_back(task.id);
+  BOOST_CHECK_EQUAL_COLLECTIONS(ids.begin(), ids.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(list.getSize(), expected.size());
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(IntrusiveLinkedListTests)
+
+BOOST_AUTO_TEST_CASE(GivenEmptyList_WhenAddingItems_ThenTheyAreLinkedInPlace)
+{
+  std::vector<Task> tasks = { 1, 2, 3, 4 };
+  TaskList list;
+
+  list.append(tasks[1]);
+  list.prepend(tasks[0]);
+  list.append(tasks[3]);
+  list.insert(list.begin() + 2, tasks[2]);
+
+  thenListContainsIds(list, { 1, 2, 3, 4 });
+  BOOST_CHECK_EQUAL(&*list.begin(), &tasks[0]);
+  BOOST_CHECK(tasks[2].hook.isLinked());
+}
+
+BOOST_AUTO_TEST_CASE(GivenList_WhenErasingItemByReference_ThenOnlyItIsUnlinked)
+{
+  std::vector<Task> tasks = { 1, 2, 3 };
+  TaskList list;
+  for (auto& task : tasks)
+    list.append(task);
+
+  list.erase(tasks[1]);
+
+  thenListContainsIds(list, { 1, 3 });
+  BOOST_CHECK(!tasks[1].hook.isLinked());
+  BOOST_CHECK_EQUAL((--list.end())->id, 3);
+}
+
+BOOST_AUTO_TEST_CASE(GivenList_WhenAddingLinkedOrErasingUnlinkedItem_ThenExceptionIsThrown)
+{
+  Task task{1};
+  Task unlinked{2};
+  TaskList list;
+  TaskList other;
+  list.append(task);
+
+  BOOST_CHECK_THROW(other.append(task), std::logic_error);
+  BOOST_CHECK_THROW(other.erase(unlinked), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenItemOfAnotherList_WhenErasingIt_ThenExceptionIsThrownAndListsAreKept)
+{
+  std::vector<Task> tasks = { 1, 2, 3 };
+  TaskList list;
+  TaskList other;
+  list.append(tasks[0]);
+  other.append(tasks[1]);
+  other.append(tasks[2]);
+
+  BOOST_CHECK_THROW(list.erase(tasks[1]), std::logic_error);
+  thenListContainsIds(list, { 1 });
+  thenListContainsIds(other, { 2, 3 });
+
+  TaskList moved{std::move(other)};
+  BOOST_CHECK_THROW(other.erase(tasks[2]), std::logic_error);
+  moved.erase(tasks[2]);
+  thenListContainsIds(moved, { 2 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenHook_WhenBuiltWithOrWithoutCheckedIterators_ThenItsSizeIsTheSame)
+{
+  // the owner field is there whether or not checked builds fill it in.
+  BOOST_CHECK_EQUAL(sizeof(aisdi::IntrusiveListHook), 3 * sizeof(void*));
+}
+
+BOOST_AUTO_TEST_CASE(GivenList_WhenPoppingAndErasingByIterator_ThenItemsAreReturnedAndUnlinked)
+{
+  std::vector<Task> tasks = { 1, 2, 3, 4, 5 };
+  TaskList list;
+  for (auto& task : tasks)
+    list.append(task);
+
+  Task& first = list.popFirst();
+  Task& last = list.popLast();
+  list.erase(list.iteratorTo(tasks[2]));
+
+  BOOST_CHECK_EQUAL(&first, &tasks[0]);
+  BOOST_CHECK_EQUAL(&last, &tasks[4]);
+  thenListContainsIds(list, { 2, 4 });
+  BOOST_CHECK_THROW(list.erase(list.end()), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenList_WhenMovingAndDestroyingIt_ThenItemsAreUnlinked)
+{
+  std::vector<Task> tasks = { 1, 2, 3 };
+  {
+    TaskList list;
+    for (auto& task : tasks)
+      list.append(task);
+
+    TaskList moved{std::move(list)};
+    BOOST_CHECK(list.isEmpty());
+    thenListContainsIds(moved, { 1, 2, 3 });
+
+    Task copy{tasks[0]};
+    BOOST_CHECK(!copy.hook.isLinked());
+  }
+
+  for (const auto& task : tasks)
+    BOOST_CHECK(!task.hook.isLinked());
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyList_WhenPopping_ThenExceptionIsThrown)
+{
+  TaskList list;
+
+  BOOST_CHECK_THROW(list.popFirst(), std::logic_error);
+  BOOST_CHECK_THROW(--list.begin(), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,9 +1,17 @@
 #include <LinkedList.h>
 
+#include <algorithm>
 #include <initializer_list>
 #include <complex>
 #include <cstdint>
 #include <cstddef>
+#include <memory>
+#include <random>
+#include <vector>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <memory_resource>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/test_tools.hpp>
@@ -29,7 +37,7 @@ public:
     ++copiedObjects;
   }
 
-  OperationCountingObject(OperationCountingObject&& other)
+  OperationCountingObject(OperationCountingObject&& other) noexcept
     : value(other.value)
   {
     ++constructedObjects;
@@ -48,7 +56,7 @@ public:
     return *this;
   }
 
-  OperationCountingObject& operator=(OperationCountingObject&& other)
+  OperationCountingObject& operator=(OperationCountingObject&& other) noexcept
   {
     ++assignedObjects;
     ++movedObjects;
@@ -116,6 +124,48 @@ std::ostream& operator<<(std::ostream& out, const OperationCountingObject& obj)
   return out << '<' << static_cast<int>(obj) << '>';
 }
 
+template <typename T>
+class CountingAllocator
+{
+public:
+  using value_type = T;
+
+  explicit CountingAllocator(std::size_t& liveAllocations_)
+    : liveAllocations(&liveAllocations_)
+  {}
+
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U>& other)
+    : liveAllocations(other.liveAllocations)
+  {}
+
+  T* allocate(std::size_t n)
+  {
+    ++*liveAllocations;
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T* p, std::size_t n)
+  {
+    --*liveAllocations;
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  template <typename U>
+  bool operator==(const CountingAllocator<U>& other) const
+  {
+    return liveAllocations == other.liveAllocations;
+  }
+
+  template <typename U>
+  bool operator!=(const CountingAllocator<U>& other) const
+  {
+    return !(*this == other);
+  }
+
+  std::size_t* liveAllocations;
+};
+
 struct Fixture
 {
   Fixture()
@@ -137,7 +187,7 @@ using TestedTypes = boost::mpl::list<std::int32_t,
 using std::begin;
 using std::end;
 
-BOOST_FIXTURE_TEST_SUITE(VectorTests, Fixture)
+BOOST_FIXTURE_TEST_SUITE(LinkedListTests, Fixture)
 
 template <typename T>
 void thenCollectionContainsValues(const LinearCollection<T>& collection,
@@ -943,6 +993,572 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenPrepend_ThenLastElementIs
   BOOST_CHECK_EQUAL(*(collection.begin()), *(--collection.end()));
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenAppendingTemporary_ThenItemIsMovedNotCopied,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+
+  OperationCountingObject::resetCounters();
+  collection.append(T{42});
+
+  thenCollectionContainsValues(collection, { 42 });
+  thenCopiedObjectsCountWas<T>(0);
+  thenMovedObjectsCountWas<T>(1);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenEmplacingItem_ThenItIsConstructedInPlace,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+
+  OperationCountingObject::resetCounters();
+  collection.emplaceAppend(42);
+
+  thenCollectionContainsValues(collection, { 42 });
+  thenConstructedObjectsCountWas<T>(1);
+  thenCopiedObjectsCountWas<T>(0);
+  thenMovedObjectsCountWas<T>(0);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenEmplacingItems_ThenItemsAreAdded,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 10, 20 };
+
+  collection.emplacePrepend(5);
+  collection.emplace(begin(collection) + 2, 15);
+  collection.emplaceAppend(25);
+
+  thenCollectionContainsValues(collection, { 5, 10, 15, 20, 25 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenPopping_ThenItemsAreNotCopied,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3 };
+
+  OperationCountingObject::resetCounters();
+  collection.popFirst();
+  collection.popLast();
+
+  thenCollectionContainsValues(collection, { 2 });
+  thenCopiedObjectsCountWas<T>(0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenMoveOnlyType_WhenAddingAndPoppingItems_ThenItemsAreMoved)
+{
+  LinearCollection<std::unique_ptr<int>> collection;
+
+  collection.append(std::unique_ptr<int>(new int(2)));
+  collection.prepend(std::unique_ptr<int>(new int(1)));
+  for (int i = 3; i < 10; ++i)
+    collection.emplaceAppend(new int(i));
+  collection.erase(begin(collection) + 2);
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 8);
+  BOOST_CHECK_EQUAL(*collection.popFirst(), 1);
+  BOOST_CHECK_EQUAL(*collection.popLast(), 9);
+  BOOST_CHECK_EQUAL(**begin(collection), 2);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollectionWithCustomAllocator_WhenChangingIt_ThenAllMemoryGoesThroughAllocator)
+{
+  std::size_t liveAllocations = 0;
+  {
+    using Collection = aisdi::LinkedList<int, CountingAllocator<int>>;
+    Collection collection{CountingAllocator<int>(liveAllocations)};
+    for (int i = 0; i < 20; ++i)
+      collection.append(i);
+    collection.erase(begin(collection), begin(collection) + 5);
+
+    Collection copy{collection};
+    Collection other{CountingAllocator<int>(liveAllocations)};
+    other = std::move(copy);
+
+    BOOST_CHECK(liveAllocations > 0);
+    BOOST_CHECK_EQUAL(other.getSize(), 15);
+    BOOST_CHECK_EQUAL(*begin(other), 5);
+  }
+  BOOST_CHECK_EQUAL(liveAllocations, 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenPmrCollection_WhenAddingItems_ThenTheyAreAllocatedFromResource)
+{
+  alignas(std::max_align_t) char buffer[4096];
+  std::pmr::monotonic_buffer_resource resource(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+  aisdi::pmr::LinkedList<int> collection(&resource);
+
+  for (int i = 0; i < 20; ++i)
+    collection.append(i);
+
+  for (const auto& item : collection)
+  {
+    BOOST_CHECK(reinterpret_cast<const char*>(&item) >= buffer);
+    BOOST_CHECK(reinterpret_cast<const char*>(&item) < buffer + sizeof(buffer));
+  }
+  BOOST_CHECK_EQUAL(collection.getSize(), 20);
+}
+
+BOOST_AUTO_TEST_CASE(GivenReservedCollection_WhenAppendingUpToReservedSize_ThenNothingIsAllocated)
+{
+  std::size_t liveAllocations = 0;
+  aisdi::LinkedList<int, CountingAllocator<int>> collection{CountingAllocator<int>(liveAllocations)};
+
+  collection.reserve(1000);
+  const auto allocationsAfterReserve = liveAllocations;
+  for (int i = 0; i < 1000; ++i)
+    collection.append(i);
+
+  BOOST_CHECK_EQUAL(liveAllocations, allocationsAfterReserve);
+  BOOST_CHECK_EQUAL(collection.getSize(), 1000);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenErasingAndAddingItems_ThenErasedNodesAreReused)
+{
+  std::size_t liveAllocations = 0;
+  aisdi::LinkedList<int, CountingAllocator<int>> collection{CountingAllocator<int>(liveAllocations)};
+  for (int i = 0; i < 100; ++i)
+    collection.append(i);
+
+  const auto allocationsBefore = liveAllocations;
+  for (int i = 0; i < 1000; ++i)
+  {
+    collection.popFirst();
+    collection.append(i);
+  }
+
+  BOOST_CHECK_EQUAL(liveAllocations, allocationsBefore);
+  BOOST_CHECK_EQUAL(collection.getSize(), 100);
+  BOOST_CHECK_EQUAL(*begin(collection), 900);
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollections_WhenCreatingAndMovingThem_ThenNothingIsAllocated)
+{
+  std::size_t liveAllocations = 0;
+  using Collection = aisdi::LinkedList<int, CountingAllocator<int>>;
+  Collection collection{CountingAllocator<int>(liveAllocations)};
+
+  Collection moved{std::move(collection)};
+  Collection assigned{CountingAllocator<int>(liveAllocations)};
+  assigned = std::move(moved);
+
+  BOOST_CHECK_EQUAL(liveAllocations, 0);
+  BOOST_CHECK(assigned.isEmpty());
+  BOOST_CHECK(std::is_nothrow_move_constructible<LinearCollection<int>>::value);
+  BOOST_CHECK(std::is_nothrow_move_assignable<LinearCollection<int>>::value);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenMovingIt_ThenBothCollectionsRemainUsable,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3 };
+
+  LinearCollection<T> moved{std::move(collection)};
+  collection.append(4);
+  moved.prepend(0);
+  moved.append(5);
+
+  thenCollectionContainsValues(collection, { 4 });
+  thenCollectionContainsValues(moved, { 0, 1, 2, 3, 5 });
+  BOOST_CHECK_EQUAL(*(--end(moved)), 5);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenErasingRangeInTheMiddle_ThenNeighboursAreLinked,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3, 4, 5, 6 };
+
+  OperationCountingObject::resetCounters();
+  collection.erase(begin(collection) + 1, begin(collection) + 4);
+
+  thenCollectionContainsValues(collection, { 1, 5, 6 });
+  thenDestroyedObjectsCountWas<T>(3);
+  BOOST_CHECK_EQUAL(*(--(--end(collection))), 5);
+  BOOST_CHECK_EQUAL(*(--(begin(collection) + 1)), 1);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenClearing_ThenItIsEmptyAndUsable,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3 };
+
+  OperationCountingObject::resetCounters();
+  collection.clear();
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK(begin(collection) == end(collection));
+  thenDestroyedObjectsCountWas<T>(3);
+
+  collection.append(4);
+  collection.prepend(3);
+  thenCollectionContainsValues(collection, { 3, 4 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenClearedCollection_WhenAddingItemsAgain_ThenNodesAreReused)
+{
+  std::size_t liveAllocations = 0;
+  aisdi::LinkedList<int, CountingAllocator<int>> collection{CountingAllocator<int>(liveAllocations)};
+  for (int i = 0; i < 100; ++i)
+    collection.append(i);
+  const auto allocationsBefore = liveAllocations;
+
+  collection.clear();
+  for (int i = 0; i < 100; ++i)
+    collection.append(i);
+
+  BOOST_CHECK_EQUAL(liveAllocations, allocationsBefore);
+  BOOST_CHECK_EQUAL(collection.getSize(), 100);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenTwoCollections_WhenSplicingWholeCollection_ThenNodesAreRelinked,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2 };
+  LinearCollection<T> other = { 3, 4, 5 };
+
+  OperationCountingObject::resetCounters();
+  collection.splice(begin(collection) + 1, other);
+
+  thenCollectionContainsValues(collection, { 1, 3, 4, 5, 2 });
+  BOOST_CHECK_EQUAL(collection.getSize(), 5);
+  BOOST_CHECK(other.isEmpty());
+  thenConstructedObjectsCountWas<T>(0);
+  thenDestroyedObjectsCountWas<T>(0);
+
+  other.append(6);
+  thenCollectionContainsValues(other, { 6 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenTwoCollections_WhenSplicingRange_ThenOnlyRangeIsMoved,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2 };
+  LinearCollection<T> other = { 3, 4, 5, 6 };
+  const T* moved = &*(begin(other) + 1);
+
+  OperationCountingObject::resetCounters();
+  collection.splice(end(collection), other, begin(other) + 1, begin(other) + 3);
+
+  thenCollectionContainsValues(collection, { 1, 2, 4, 5 });
+  thenCollectionContainsValues(other, { 3, 6 });
+  BOOST_CHECK_EQUAL(collection.getSize(), 4);
+  BOOST_CHECK_EQUAL(other.getSize(), 2);
+  BOOST_CHECK_EQUAL(&*(begin(collection) + 2), moved);
+  thenConstructedObjectsCountWas<T>(0);
+  thenDestroyedObjectsCountWas<T>(0);
+
+  other.append(7);
+  collection.erase(begin(collection) + 2);
+  thenCollectionContainsValues(other, { 3, 6, 7 });
+  thenCollectionContainsValues(collection, { 1, 2, 5 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenSplicingRangeWithinIt_ThenItemsAreReordered,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3, 4, 5 };
+
+  collection.splice(begin(collection), collection, begin(collection) + 3, end(collection));
+
+  thenCollectionContainsValues(collection, { 4, 5, 1, 2, 3 });
+  BOOST_CHECK_EQUAL(collection.getSize(), 5);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenSplicingRangeIntoItself_ThenCollectionIsUnchanged,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3, 4, 5 };
+
+  collection.splice(begin(collection) + 1, collection, begin(collection) + 1, begin(collection) + 4);
+  collection.splice(begin(collection) + 2, collection, begin(collection) + 1, begin(collection) + 4);
+  collection.splice(begin(collection) + 4, collection, begin(collection) + 1, begin(collection) + 4);
+
+  thenCollectionContainsValues(collection, { 1, 2, 3, 4, 5 });
+  BOOST_CHECK_EQUAL(collection.getSize(), 5);
+  BOOST_CHECK_EQUAL(*(end(collection) - 1), 5);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenSplittingAndConcatenating_ThenItemsAreKept,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3, 4, 5 };
+  const T* third = &*(begin(collection) + 2);
+
+  OperationCountingObject::resetCounters();
+  LinearCollection<T> rest = collection.splitAt(begin(collection) + 2);
+  thenCollectionContainsValues(collection, { 1, 2 });
+  thenCollectionContainsValues(rest, { 3, 4, 5 });
+  BOOST_CHECK_EQUAL(rest.getSize(), 3);
+  BOOST_CHECK_EQUAL(&*begin(rest), third);
+  thenConstructedObjectsCountWas<T>(0);
+
+  rest.concatenate(collection);
+  thenCollectionContainsValues(rest, { 3, 4, 5, 1, 2 });
+  BOOST_CHECK(collection.isEmpty());
+  thenCopiedObjectsCountWas<T>(0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollectionsSharingNodes_WhenDestroyingThemInAnyOrder_ThenAllMemoryIsReleased)
+{
+  std::size_t liveAllocations = 0;
+  {
+    using Collection = aisdi::LinkedList<std::string, CountingAllocator<std::string>>;
+    Collection first{CountingAllocator<std::string>(liveAllocations)};
+    Collection third{CountingAllocator<std::string>(liveAllocations)};
+    for (int i = 0; i < 20; ++i)
+    {
+      first.append(std::to_string(i));
+      third.prepend(std::to_string(i));
+    }
+    {
+      Collection second = first.splitAt(begin(first) + 10);
+      second.concatenate(third);
+      third.append("last");
+      first.splice(begin(first), second, begin(second), begin(second) + 5);
+      BOOST_CHECK_EQUAL(second.getSize(), 25);
+    }
+    first.clear();
+    for (int i = 0; i < 50; ++i)
+      third.append(std::to_string(i));
+
+    BOOST_CHECK_EQUAL(first.getSize(), 0);
+    BOOST_CHECK_EQUAL(third.getSize(), 51);
+    BOOST_CHECK_EQUAL(*begin(third), "last");
+  }
+  BOOST_CHECK_EQUAL(liveAllocations, 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollectionsSharingDifferentPools_WhenSplicingBetweenThem_ThenValuesAreMoved)
+{
+  std::size_t liveAllocations = 0;
+  {
+    using Collection = aisdi::LinkedList<std::string, CountingAllocator<std::string>>;
+    Collection first{CountingAllocator<std::string>(liveAllocations)};
+    Collection third{CountingAllocator<std::string>(liveAllocations)};
+    for (int i = 0; i < 10; ++i)
+    {
+      first.append(std::to_string(i));
+      third.append(std::to_string(10 + i));
+    }
+    Collection second = first.splitAt(begin(first) + 5);
+    Collection fourth = third.splitAt(begin(third) + 5);
+
+    first.splice(end(first), third, begin(third), begin(third) + 2);
+
+    BOOST_CHECK_EQUAL(first.getSize(), 7);
+    BOOST_CHECK_EQUAL(third.getSize(), 3);
+    BOOST_CHECK_EQUAL(*(end(first) - 1), "11");
+    BOOST_CHECK_EQUAL(*begin(third), "12");
+    second.concatenate(fourth);
+    BOOST_CHECK_EQUAL(second.getSize(), 10);
+  }
+  BOOST_CHECK_EQUAL(liveAllocations, 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSplicedCollections_WhenUsedFromSeparateThreads_ThenEachKeepsItsItems)
+{
+  aisdi::LinkedList<std::string> producer;
+  aisdi::LinkedList<std::string> consumer;
+  for (int i = 0; i < 100; ++i)
+    producer.append(std::to_string(i));
+  consumer.splice(end(consumer), producer, begin(producer), begin(producer) + 30);
+  consumer.splice(end(consumer), producer, begin(producer), begin(producer) + 60);
+  producer.append("x");
+  consumer.concatenate(producer);
+
+  const auto churn = [](aisdi::LinkedList<std::string>& collection) {
+    for (int i = 0; i < 20000; ++i)
+    {
+      collection.append(std::to_string(i));
+      collection.popFirst();
+    }
+  };
+  std::thread producerThread(churn, std::ref(producer));
+  std::thread consumerThread(churn, std::ref(consumer));
+  producerThread.join();
+  consumerThread.join();
+
+  BOOST_CHECK(producer.isEmpty());
+  BOOST_CHECK_EQUAL(consumer.getSize(), 101);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollectionsWithUnequalAllocators_WhenSplicing_ThenValuesAreMoved)
+{
+  std::size_t firstAllocations = 0;
+  std::size_t secondAllocations = 0;
+  {
+    using Collection = aisdi::LinkedList<std::string, CountingAllocator<std::string>>;
+    Collection collection{CountingAllocator<std::string>(firstAllocations)};
+    Collection other{CountingAllocator<std::string>(secondAllocations)};
+    collection.append("a");
+    other.append("b");
+    other.append("c");
+
+    collection.splice(end(collection), other);
+
+    BOOST_CHECK(other.isEmpty());
+    BOOST_CHECK_EQUAL(collection.getSize(), 3);
+    BOOST_CHECK_EQUAL(*(begin(collection) + 2), "c");
+  }
+  BOOST_CHECK_EQUAL(firstAllocations, 0);
+  BOOST_CHECK_EQUAL(secondAllocations, 0);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenAccessingByIndex_ThenItemsAreReturned,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3, 4, 5, 6 };
+
+  BOOST_CHECK_EQUAL(collection.at(2), 3);
+  BOOST_CHECK_EQUAL(collection.at(5), 6);
+  BOOST_CHECK_EQUAL(collection.at(0), 1);
+  BOOST_CHECK_EQUAL(*collection.iteratorAt(4), 5);
+  BOOST_CHECK(collection.iteratorAt(6) == end(collection));
+  BOOST_CHECK_THROW(collection.at(6), std::out_of_range);
+  BOOST_CHECK_THROW(collection.iteratorAt(7), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenLargeCollection_WhenScanningByIncreasingIndex_ThenEveryItemIsVisited)
+{
+  aisdi::LinkedList<int> collection;
+  for (int i = 0; i < 50000; ++i)
+    collection.append(i);
+
+  long long sum = 0;
+  for (std::size_t i = 0; i < collection.getSize(); ++i)
+    sum += collection.at(i);
+
+  BOOST_CHECK_EQUAL(sum, 50000LL * 49999 / 2);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSharedConstCollection_WhenAccessingByIndexFromTwoThreads_ThenItemsAreReturned)
+{
+  aisdi::LinkedList<int> collection;
+  for (int i = 0; i < 200; ++i)
+    collection.append(i);
+  collection.at(100);
+  const aisdi::LinkedList<int>& shared = collection;
+
+  const auto scan = [&shared](long long& sum) {
+    for (int round = 0; round < 20; ++round)
+      for (std::size_t i = 0; i < shared.getSize(); ++i)
+        sum += shared.at(i) + *shared.iteratorAt(shared.getSize() - 1 - i);
+  };
+  long long firstSum = 0;
+  long long secondSum = 0;
+  std::thread first(scan, std::ref(firstSum));
+  std::thread second(scan, std::ref(secondSum));
+  first.join();
+  second.join();
+
+  BOOST_CHECK_EQUAL(firstSum, 20LL * 200 * 199);
+  BOOST_CHECK_EQUAL(secondSum, 20LL * 200 * 199);
+}
+
+BOOST_AUTO_TEST_CASE(GivenRandomModifications_WhenAccessingByIndex_ThenItemsMatchVector)
+{
+  std::mt19937 generator(5);
+  aisdi::LinkedList<int> collection;
+  std::vector<int> expected;
+
+  for (int step = 0; step < 5000; ++step)
+  {
+    const std::size_t position = expected.empty() ? 0 : generator() % (expected.size() + 1);
+    const int operation = generator() % 6;
+    if (operation < 3 || expected.empty())
+    {
+      collection.insert(operation == 0 ? collection.iteratorAt(position) :
+                        operation == 1 ? begin(collection) : end(collection), step);
+      expected.insert(operation == 0 ? expected.begin() + position :
+                      operation == 1 ? expected.begin() : expected.end(), step);
+    }
+    else if (operation == 3)
+    {
+      const std::size_t erased = std::min<std::size_t>(generator() % 4, expected.size() - position);
+      collection.erase(collection.iteratorAt(position), collection.iteratorAt(position + erased));
+      expected.erase(expected.begin() + position, expected.begin() + (position + erased));
+    }
+    else if (operation == 4 && position < expected.size())
+    {
+      collection.erase(collection.iteratorAt(position));
+      expected.erase(expected.begin() + position);
+    }
+    else
+    {
+      collection.popFirst();
+      expected.erase(expected.begin());
+    }
+
+    if (!expected.empty())
+    {
+      const std::size_t probe = generator() % expected.size();
+      BOOST_REQUIRE_EQUAL(collection.at(probe), expected[probe]);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GivenShuffledCollection_WhenSorting_ThenItemsAreOrderedStablyAndIteratorsFollowThem)
+{
+  std::mt19937 generator(19);
+  aisdi::LinkedList<std::pair<int, int>> collection;
+  std::vector<std::pair<int, int>> expected;
+  for (int i = 0; i < 1000; ++i)
+  {
+    collection.append({ static_cast<int>(generator() % 50), i });
+    expected.push_back({ collection.at(i).first, i });
+  }
+  const auto tracked = collection.iteratorAt(500);
+  const auto trackedValue = *tracked;
+
+  const auto byKey = [](const std::pair<int, int>& a, const std::pair<int, int>& b) { return a.first < b.first; };
+  collection.sort(byKey);
+  std::stable_sort(expected.begin(), expected.end(), byKey);
+
+  BOOST_CHECK(std::equal(begin(collection), end(collection), expected.begin(), expected.end()));
+  BOOST_CHECK(*tracked == trackedValue);
+  BOOST_CHECK((*(--end(collection))).first == 49);
+  BOOST_CHECK(collection.at(999) == expected[999]);
+}
+
+BOOST_AUTO_TEST_CASE(GivenThrowingComparison_WhenSorting_ThenCollectionKeepsAllItems)
+{
+  aisdi::LinkedList<int> collection;
+  for (int i = 0; i < 100; ++i)
+    collection.append(99 - i);
+
+  int comparisons = 0;
+  BOOST_CHECK_THROW(collection.sort([&](int a, int b) {
+                      if (++comparisons == 300)
+                        throw std::runtime_error("comparison failed");
+                      return a < b;
+                    }),
+                    std::runtime_error);
+
+  std::vector<int> items(begin(collection), end(collection));
+  std::sort(items.begin(), items.end());
+  BOOST_CHECK_EQUAL(collection.getSize(), 100u);
+  for (int i = 0; i < 100; ++i)
+    BOOST_CHECK_EQUAL(items[i], i);
+  BOOST_CHECK_EQUAL(*(--end(collection)), *(end(collection) - 1));
+
+  collection.sort();
+  BOOST_CHECK_EQUAL(*begin(collection), 0);
+  BOOST_CHECK_EQUAL(*(--end(collection)), 99);
+}
+
 // ConstIterator is tested via Iterator methods.
 // If Iterator methods are to be changed, then new ConstIterator tests are required.
 
@@ -0,0 +1,158 @@
+#include <SegmentedVector.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+namespace
+{
+
+template <typename Collection>
+void thenCollectionContainsValues(const Collection& collection, std::initializer_list<int> expected)
+{
+  BOOST_CHECK_EQUAL_COLLECTIONS(collection.begin(), collection.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(collection.getSize(), expected.size());
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(SegmentedVectorTests)
+
+BOOST_AUTO_TEST_CASE(GivenDefaultBlockSize_WhenComputed_ThenItFillsSixteenKilobytes)
+{
+  BOOST_CHECK_EQUAL(aisdi::segmentedVectorBlockSize(sizeof(std::int32_t)), 4096u);
+  BOOST_CHECK_EQUAL(aisdi::segmentedVectorBlockSize(12), 1024u);
+  BOOST_CHECK_EQUAL(aisdi::segmentedVectorBlockSize(4096), 16u);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenAppendingManyBlocks_ThenReferencesStayValid)
+{
+  aisdi::SegmentedVector<int, 16> collection;
+  BOOST_CHECK_EQUAL(collection.getCapacity(), 0u);
+  collection.append(0);
+  const int* first = &collection[0];
+  const int* fifth = nullptr;
+
+  for (int i = 1; i < 1000; ++i)
+  {
+    collection.append(i);
+    if (i == 5)
+      fifth = &collection.at(5);
+  }
+
+  BOOST_CHECK_EQUAL(first, &collection[0]);
+  BOOST_CHECK_EQUAL(fifth, &collection[5]);
+  BOOST_CHECK_EQUAL(*fifth, 5);
+  BOOST_CHECK_EQUAL(collection.getCapacity(), 1008u);
+  BOOST_CHECK_EQUAL(collection[999], 999);
+  BOOST_CHECK_THROW(collection.at(1000), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollectionFillingItsBlocks_WhenIterating_ThenEndIsReachedBothWays)
+{
+  aisdi::SegmentedVector<int, 16> collection;
+  for (int i = 0; i < 64; ++i)
+    collection.append(i);
+
+  int expected = 0;
+  for (const auto value : collection)
+    BOOST_CHECK_EQUAL(value, expected++);
+  BOOST_CHECK_EQUAL(expected, 64);
+  BOOST_CHECK_EQUAL(*(--collection.end()), 63);
+  BOOST_CHECK_EQUAL(*(collection.end() - 17), 47);
+  BOOST_CHECK_EQUAL(collection.begin()[33], 33);
+  BOOST_CHECK_EQUAL(collection.end() - collection.begin(), 64);
+  BOOST_CHECK_THROW(*collection.end(), std::out_of_range);
+  BOOST_CHECK_THROW(--collection.begin(), std::out_of_range);
+
+  auto it = collection.begin() + 15;
+  ++it;
+  BOOST_CHECK_EQUAL(*it, 16);
+  --it;
+  BOOST_CHECK_EQUAL(*it, 15);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenInsertingErasingAndPopping_ThenOrderIsKept)
+{
+  aisdi::SegmentedVector<int, 16> collection = { 2, 4 };
+  collection.prepend(1);
+  collection.insert(collection.begin() + 2, 3);
+  collection.append(5);
+  collection.erase(collection.begin() + 1);
+  collection.erase(collection.begin() + 2, collection.end());
+
+  thenCollectionContainsValues(collection, { 1, 3 });
+  BOOST_CHECK_EQUAL(collection.popLast(), 3);
+  BOOST_CHECK_EQUAL(collection.popFirst(), 1);
+  BOOST_CHECK_THROW(collection.popFirst(), std::logic_error);
+  BOOST_CHECK_THROW(collection.erase(collection.end()), std::out_of_range);
+  BOOST_CHECK_EQUAL(collection.getCapacity(), 16u);
+  collection.shrinkToFit();
+  BOOST_CHECK_EQUAL(collection.getCapacity(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCopyingAndMoving_ThenContentsFollow)
+{
+  aisdi::SegmentedVector<int, 16> ints;
+  aisdi::SegmentedVector<std::string, 16> strings;
+  for (int i = 0; i < 40; ++i)
+  {
+    ints.append(i);
+    strings.append(std::to_string(i));
+  }
+
+  aisdi::SegmentedVector<int, 16> intsCopy{ints};
+  aisdi::SegmentedVector<std::string, 16> stringsCopy{strings};
+  BOOST_CHECK(std::equal(ints.begin(), ints.end(), intsCopy.begin(), intsCopy.end()));
+  BOOST_CHECK(std::equal(strings.begin(), strings.end(), stringsCopy.begin(), stringsCopy.end()));
+
+  const std::string* element = &strings[20];
+  aisdi::SegmentedVector<std::string, 16> moved{std::move(strings)};
+  BOOST_CHECK(strings.isEmpty());
+  BOOST_CHECK_EQUAL(element, &moved[20]);
+  strings = moved;
+  moved = std::move(stringsCopy);
+  BOOST_CHECK_EQUAL(strings[39], "39");
+  BOOST_CHECK_EQUAL(moved.getSize(), 40u);
+}
+
+BOOST_AUTO_TEST_CASE(GivenRandomOperations_WhenComparedWithVector_ThenContentsMatch)
+{
+  std::mt19937 generator(22);
+  aisdi::SegmentedVector<std::string, 16> collection;
+  std::vector<std::string> expected;
+
+  for (int step = 0; step < 3000; ++step)
+  {
+    const std::size_t position = expected.empty() ? 0 : generator() % (expected.size() + 1);
+    const int operation = generator() % 4;
+    if (operation < 2 || expected.empty())
+    {
+      collection.append(std::to_string(step));
+      expected.push_back(std::to_string(step));
+    }
+    else if (operation == 2)
+    {
+      collection.insert(collection.begin() + position, std::to_string(step));
+      expected.insert(expected.begin() + position, std::to_string(step));
+    }
+    else
+    {
+      const std::size_t erased = std::min<std::size_t>(generator() % 4, expected.size() - position);
+      collection.erase(collection.begin() + position, collection.begin() + (position + erased));
+      expected.erase(expected.begin() + position, expected.begin() + (position + erased));
+    }
+  }
+
+  BOOST_CHECK_EQUAL_COLLECTIONS(collection.begin(), collection.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
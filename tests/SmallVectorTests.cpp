@@ -0,0 +1,183 @@
+#include <SmallVector.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+namespace
+{
+
+template <typename T>
+class CountingAllocator
+{
+public:
+  using value_type = T;
+
+  explicit CountingAllocator(std::size_t& liveAllocations_)
+    : liveAllocations(&liveAllocations_)
+  {}
+
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U>& other)
+    : liveAllocations(other.liveAllocations)
+  {}
+
+  T* allocate(std::size_t n)
+  {
+    ++*liveAllocations;
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T* p, std::size_t n)
+  {
+    --*liveAllocations;
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  template <typename U>
+  bool operator==(const CountingAllocator<U>& other) const
+  {
+    return liveAllocations == other.liveAllocations;
+  }
+
+  template <typename U>
+  bool operator!=(const CountingAllocator<U>& other) const
+  {
+    return !(*this == other);
+  }
+
+  std::size_t* liveAllocations;
+};
+
+template <typename T>
+using CountedSmallVector = aisdi::SmallVector<T, 4, aisdi::OneAndHalfGrowth, CountingAllocator<T>>;
+
+template <typename Collection>
+void thenCollectionContainsValues(const Collection& collection, std::initializer_list<int> expected)
+{
+  BOOST_CHECK_EQUAL_COLLECTIONS(collection.begin(), collection.end(), expected.begin(), expected.end());
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(SmallVectorTests)
+
+BOOST_AUTO_TEST_CASE(GivenSmallVector_WhenAddingItemsUpToInlineCapacity_ThenNothingIsAllocated)
+{
+  std::size_t liveAllocations = 0;
+  CountedSmallVector<int> collection{CountingAllocator<int>(liveAllocations)};
+
+  for (int i = 0; i < 4; ++i)
+    collection.append(i);
+
+  BOOST_CHECK(collection.isSmall());
+  BOOST_CHECK_EQUAL(liveAllocations, 0);
+  BOOST_CHECK_EQUAL(collection.getCapacity(), 4);
+  thenCollectionContainsValues(collection, { 0, 1, 2, 3 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenFullSmallVector_WhenAddingItem_ThenItSpillsToHeap)
+{
+  std::size_t liveAllocations = 0;
+  {
+    CountedSmallVector<int> collection{CountingAllocator<int>(liveAllocations)};
+    for (int i = 0; i < 4; ++i)
+      collection.append(i);
+
+    collection.prepend(-1);
+
+    BOOST_CHECK(!collection.isSmall());
+    BOOST_CHECK_EQUAL(liveAllocations, 1);
+    thenCollectionContainsValues(collection, { -1, 0, 1, 2, 3 });
+  }
+  BOOST_CHECK_EQUAL(liveAllocations, 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSpilledSmallVector_WhenShrinkingBelowInlineCapacity_ThenItReturnsToInlineStorage)
+{
+  std::size_t liveAllocations = 0;
+  CountedSmallVector<std::string> collection{CountingAllocator<std::string>(liveAllocations)};
+  for (int i = 0; i < 10; ++i)
+    collection.append(std::to_string(i));
+  collection.erase(collection.begin() + 2, collection.end());
+
+  collection.shrinkToFit();
+
+  BOOST_CHECK(collection.isSmall());
+  BOOST_CHECK_EQUAL(liveAllocations, 0);
+  BOOST_CHECK_EQUAL(collection.getSize(), 2);
+  BOOST_CHECK_EQUAL(*(collection.begin() + 1), "1");
+}
+
+BOOST_AUTO_TEST_CASE(GivenSmallVector_WhenCopying_ThenItemsAreCopied)
+{
+  aisdi::SmallVector<std::string, 2> small = { "a", "b" };
+  aisdi::SmallVector<std::string, 2> large = { "a", "b", "c" };
+
+  aisdi::SmallVector<std::string, 2> smallCopy{small};
+  aisdi::SmallVector<std::string, 2> largeCopy{large};
+  smallCopy = large;
+  large.append("d");
+
+  BOOST_CHECK_EQUAL(smallCopy.getSize(), 3);
+  BOOST_CHECK_EQUAL(largeCopy.getSize(), 3);
+  BOOST_CHECK_EQUAL(*(largeCopy.begin() + 2), "c");
+  BOOST_CHECK_EQUAL(large.getSize(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSmallVector_WhenMoving_ThenItemsAreMovedAndSourceIsUsable)
+{
+  aisdi::SmallVector<std::unique_ptr<int>, 2> small;
+  small.emplaceAppend(new int(1));
+  aisdi::SmallVector<std::unique_ptr<int>, 2> large;
+  for (int i = 0; i < 5; ++i)
+    large.emplaceAppend(new int(i));
+
+  aisdi::SmallVector<std::unique_ptr<int>, 2> fromSmall{std::move(small)};
+  aisdi::SmallVector<std::unique_ptr<int>, 2> fromLarge{std::move(large)};
+
+  BOOST_CHECK(fromSmall.isSmall());
+  BOOST_CHECK_EQUAL(**fromSmall.begin(), 1);
+  BOOST_CHECK_EQUAL(fromLarge.getSize(), 5);
+  BOOST_CHECK(small.isEmpty());
+  BOOST_CHECK(large.isEmpty());
+  BOOST_CHECK(large.isSmall());
+
+  large.emplaceAppend(new int(7));
+  fromSmall = std::move(fromLarge);
+  BOOST_CHECK_EQUAL(fromSmall.getSize(), 5);
+  BOOST_CHECK_EQUAL(**large.begin(), 7);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSmallVector_WhenUsedThroughVectorInterface_ThenItWorks)
+{
+  aisdi::SmallVector<int, 8> small = { 5, 2, 7 };
+
+  small.append(1);
+  std::sort(small.begin(), small.end());
+  const aisdi::Vector<int>& vector = small.asVector();
+
+  thenCollectionContainsValues(vector, { 1, 2, 5, 7 });
+  BOOST_CHECK(small.isSmall());
+  aisdi::Vector<int> copy(small.asVector());
+  thenCollectionContainsValues(copy, { 1, 2, 5, 7 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenSmallVector_WhenTreatedAsMutableVector_ThenItDoesNotCompile)
+{
+  // moving out of a Vector& bound to inline elements would steal a buffer the Vector cannot own.
+  using Small = aisdi::SmallVector<int, 8>;
+  BOOST_CHECK((!std::is_convertible<Small&, aisdi::Vector<int>&>::value));
+  BOOST_CHECK((!std::is_constructible<aisdi::Vector<int>, Small&&>::value));
+  BOOST_CHECK((!std::is_assignable<aisdi::Vector<int>&, Small&&>::value));
+  BOOST_CHECK((std::is_nothrow_move_constructible<aisdi::Vector<int>>::value));
+  BOOST_CHECK((std::is_nothrow_move_assignable<aisdi::Vector<int>>::value));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,177 @@
+#include <SpscRing.h>
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+BOOST_AUTO_TEST_SUITE(SpscRingTests)
+
+BOOST_AUTO_TEST_CASE(GivenRing_WhenCreated_ThenCapacityIsRoundedToPowerOfTwo)
+{
+  BOOST_CHECK_EQUAL(aisdi::SpscRing<int>(0).getCapacity(), 1u);
+  BOOST_CHECK_EQUAL(aisdi::SpscRing<int>(5).getCapacity(), 8u);
+  BOOST_CHECK_EQUAL(aisdi::SpscRing<int>(64).getCapacity(), 64u);
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyRing_WhenPushingAndPopping_ThenItemsComeOutInOrder)
+{
+  aisdi::SpscRing<std::string> ring(4);
+  std::string item;
+  BOOST_CHECK(ring.isEmpty());
+  BOOST_CHECK(!ring.tryPop(item));
+
+  BOOST_CHECK(ring.tryPush("a"));
+  BOOST_CHECK(ring.tryEmplace(2, 'b'));
+  BOOST_CHECK_EQUAL(ring.getSize(), 2u);
+  BOOST_CHECK(ring.tryPop(item));
+  BOOST_CHECK_EQUAL(item, "a");
+  BOOST_CHECK(ring.tryPop(item));
+  BOOST_CHECK_EQUAL(item, "bb");
+  BOOST_CHECK(!ring.tryPop(item));
+  BOOST_CHECK(ring.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenFullRing_WhenPushing_ThenPushFailsUntilItemIsPopped)
+{
+  aisdi::SpscRing<int> ring(4);
+  for (int i = 0; i < 4; ++i)
+    BOOST_CHECK(ring.tryPush(i));
+  BOOST_CHECK(!ring.tryPush(4));
+
+  int item;
+  BOOST_CHECK(ring.tryPop(item));
+  BOOST_CHECK_EQUAL(item, 0);
+  BOOST_CHECK(ring.tryPush(4));
+  for (int expected = 1; expected <= 4; ++expected) {
+    BOOST_CHECK(ring.tryPop(item));
+    BOOST_CHECK_EQUAL(item, expected);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GivenRing_WhenPushingMoveOnlyItems_ThenTheyAreMovedThrough)
+{
+  aisdi::SpscRing<std::unique_ptr<int>> ring(2);
+  BOOST_CHECK(ring.tryPush(std::make_unique<int>(1)));
+  std::vector<std::unique_ptr<int>> batch;
+  batch.push_back(std::make_unique<int>(2));
+  batch.push_back(std::make_unique<int>(3));
+  BOOST_CHECK_EQUAL(ring.pushBatch(std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end())), 1u);
+  BOOST_CHECK(batch[0] == nullptr);
+  BOOST_CHECK(batch[1] != nullptr);
+
+  std::vector<std::unique_ptr<int>> popped;
+  BOOST_CHECK_EQUAL(ring.popBatch(std::back_inserter(popped), 5), 2u);
+  BOOST_CHECK_EQUAL(*popped[0], 1);
+  BOOST_CHECK_EQUAL(*popped[1], 2);
+}
+
+BOOST_AUTO_TEST_CASE(GivenRing_WhenBatchesWrapAround_ThenOrderIsKept)
+{
+  aisdi::SpscRing<int> ring(8);
+  std::vector<int> popped;
+  int next = 0;
+  for (int round = 0; round < 20; ++round) {
+    std::vector<int> batch;
+    for (int i = 0; i < 5; ++i)
+      batch.push_back(next++);
+    // a batch takes the room known from the last refresh, so the rest goes in with a second call.
+    const std::size_t pushed = ring.pushBatch(batch.begin(), batch.end());
+    BOOST_CHECK(pushed > 0);
+    BOOST_CHECK_EQUAL(ring.pushBatch(batch.begin() + pushed, batch.end()), 5u - pushed);
+    BOOST_CHECK_EQUAL(ring.pushBatch(batch.end(), batch.end()), 0u);
+    const std::size_t first = ring.popBatch(std::back_inserter(popped), 5);
+    BOOST_CHECK_EQUAL(first + ring.popBatch(std::back_inserter(popped), 5 - first), 5u);
+  }
+  BOOST_CHECK_EQUAL(ring.popBatch(std::back_inserter(popped), 5), 0u);
+  BOOST_REQUIRE_EQUAL(popped.size(), 100u);
+  for (int i = 0; i < 100; ++i)
+    BOOST_CHECK_EQUAL(popped[i], i);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCachedIndexWithRoom_WhenPushingBatch_ThenOnlyTheKnownRoomIsUsed)
+{
+  aisdi::SpscRing<int> ring(4);
+  const std::vector<int> items = { 0, 1, 2, 3, 4, 5 };
+  BOOST_CHECK_EQUAL(ring.pushBatch(items.begin(), items.begin() + 3), 3u);
+  int item;
+  BOOST_CHECK(ring.tryPop(item));
+  BOOST_CHECK(ring.tryPop(item));
+
+  // one free slot is known without rereading the consumer's index.
+  BOOST_CHECK_EQUAL(ring.pushBatch(items.begin() + 3, items.end()), 1u);
+  BOOST_CHECK_EQUAL(ring.pushBatch(items.begin() + 4, items.end()), 2u);
+  BOOST_CHECK_EQUAL(ring.getSize(), 4u);
+
+  std::vector<int> popped;
+  BOOST_CHECK_EQUAL(ring.popBatch(std::back_inserter(popped), 10), 1u);
+  BOOST_CHECK_EQUAL(ring.popBatch(std::back_inserter(popped), 10), 3u);
+  const std::vector<int> expected = { 2, 3, 4, 5 };
+  BOOST_CHECK_EQUAL_COLLECTIONS(popped.begin(), popped.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenRingWithItems_WhenDestroyed_ThenItemsAreReleased)
+{
+  const auto shared = std::make_shared<int>(7);
+  {
+    aisdi::SpscRing<std::shared_ptr<int>> ring(16);
+    for (int i = 0; i < 16; ++i)
+      ring.tryPush(shared);
+    std::shared_ptr<int> item;
+    for (int i = 0; i < 10; ++i)
+      ring.tryPop(item);
+    item.reset();
+    for (int i = 0; i < 5; ++i)
+      ring.tryPush(shared);
+    BOOST_CHECK_EQUAL(shared.use_count(), 12);
+  }
+  BOOST_CHECK_EQUAL(shared.use_count(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(GivenProducerAndConsumer_WhenRunningConcurrently_ThenEveryItemArrivesInOrder)
+{
+  const int total = 200000;
+  aisdi::SpscRing<int> ring(64);
+
+  std::thread producer([&]() {
+    int next = 0;
+    while (next < total) {
+      if (next % 3 == 0) {
+        int batch[7];
+        int count = 0;
+        for (; count < 7 && next + count < total; ++count)
+          batch[count] = next + count;
+        next += static_cast<int>(ring.pushBatch(batch, batch + count));
+      } else if (ring.tryPush(next)) {
+        ++next;
+      }
+      if (next < total && ring.getSize() == ring.getCapacity())
+        std::this_thread::yield();
+    }
+  });
+
+  std::vector<int> popped;
+  popped.reserve(total);
+  while (popped.size() < std::size_t(total)) {
+    int item;
+    if (popped.size() % 2 == 0 && ring.tryPop(item))
+      popped.push_back(item);
+    else if (ring.popBatch(std::back_inserter(popped), 11) == 0)
+      std::this_thread::yield();
+  }
+  producer.join();
+
+  bool inOrder = true;
+  for (int i = 0; i < total; ++i)
+    inOrder = inOrder && popped[i] == i;
+  BOOST_CHECK(inOrder);
+  BOOST_CHECK(ring.isEmpty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,140 @@
+#include <UnrolledLinkedList.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+namespace
+{
+
+// Small chunks, so that a handful of items already splits and merges them.
+template <typename T>
+using SmallChunkList = aisdi::UnrolledLinkedList<T, 4>;
+
+template <typename Collection>
+void thenCollectionContainsValues(const Collection& collection, std::initializer_list<int> expected)
+{
+  BOOST_CHECK_EQUAL_COLLECTIONS(collection.begin(), collection.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(collection.getSize(), expected.size());
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(UnrolledLinkedListTests)
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollection_WhenAddingItemsAtBothEnds_ThenTheyAreInOrder)
+{
+  SmallChunkList<int> collection;
+
+  for (int i = 5; i < 10; ++i)
+    collection.append(i);
+  for (int i = 4; i >= 0; --i)
+    collection.prepend(i);
+
+  thenCollectionContainsValues(collection, { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 });
+  BOOST_CHECK_EQUAL(*(--collection.end()), 9);
+  BOOST_CHECK_EQUAL(*(collection.begin() + 7), 7);
+  BOOST_CHECK_EQUAL(*(collection.end() - 3), 7);
+}
+
+BOOST_AUTO_TEST_CASE(GivenFullChunk_WhenInsertingInTheMiddle_ThenItIsSplit)
+{
+  SmallChunkList<int> collection = { 1, 2, 3, 4 };
+
+  collection.insert(collection.begin() + 1, 10);
+  collection.insert(collection.begin() + 4, 11);
+  collection.insert(collection.begin() + 4, *(collection.begin() + 2));
+
+  thenCollectionContainsValues(collection, { 1, 10, 2, 3, 2, 11, 4 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenErasingItems_ThenChunksAreMergedAndIterationStaysConsistent)
+{
+  SmallChunkList<int> collection;
+  for (int i = 0; i < 12; ++i)
+    collection.append(i);
+
+  collection.erase(collection.begin() + 1);
+  collection.erase(collection.begin() + 1, collection.begin() + 6);
+  collection.erase(--collection.end());
+
+  thenCollectionContainsValues(collection, { 0, 7, 8, 9, 10 });
+  auto it = collection.end();
+  for (int expected : { 10, 9, 8, 7, 0 })
+    BOOST_CHECK_EQUAL(*(--it), expected);
+  BOOST_CHECK(it == collection.begin());
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenPoppingAndErasingEverything_ThenItIsEmptyAndUsable)
+{
+  SmallChunkList<std::string> collection = { "a", "b", "c", "d", "e", "f" };
+
+  BOOST_CHECK_EQUAL(collection.popFirst(), "a");
+  BOOST_CHECK_EQUAL(collection.popLast(), "f");
+  collection.erase(collection.begin(), collection.end());
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK(collection.begin() == collection.end());
+  BOOST_CHECK_THROW(collection.popFirst(), std::logic_error);
+  BOOST_CHECK_THROW(collection.erase(collection.end()), std::out_of_range);
+  BOOST_CHECK_THROW(*collection.begin(), std::out_of_range);
+
+  collection.append("g");
+  BOOST_CHECK_EQUAL(*collection.begin(), "g");
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCopyingAndMoving_ThenItemsAreKept)
+{
+  SmallChunkList<std::unique_ptr<int>> moveOnly;
+  for (int i = 0; i < 9; ++i)
+    moveOnly.emplaceAppend(new int(i));
+  SmallChunkList<std::unique_ptr<int>> moved{std::move(moveOnly)};
+  BOOST_CHECK(moveOnly.isEmpty());
+  BOOST_CHECK_EQUAL(**(moved.begin() + 8), 8);
+
+  SmallChunkList<std::string> collection = { "a", "b", "c", "d", "e" };
+  SmallChunkList<std::string> copy{collection};
+  collection = copy;
+  copy.append("f");
+  SmallChunkList<std::string> other;
+  other = std::move(copy);
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 5);
+  BOOST_CHECK_EQUAL(other.getSize(), 6);
+  BOOST_CHECK_EQUAL(*(other.begin() + 5), "f");
+}
+
+BOOST_AUTO_TEST_CASE(GivenRandomOperations_WhenComparedWithVector_ThenContentsMatch)
+{
+  std::mt19937 generator(7);
+  SmallChunkList<std::string> collection;
+  std::vector<std::string> expected;
+
+  for (int step = 0; step < 3000; ++step)
+  {
+    const std::size_t position = expected.empty() ? 0 : generator() % (expected.size() + 1);
+    if (generator() % 3 != 0 || expected.empty())
+    {
+      collection.insert(collection.begin() + position, std::to_string(step));
+      expected.insert(expected.begin() + position, std::to_string(step));
+    }
+    else
+    {
+      const std::size_t erased = std::min<std::size_t>(generator() % 6, expected.size() - position);
+      collection.erase(collection.begin() + position, collection.begin() + (position + erased));
+      expected.erase(expected.begin() + position, expected.begin() + (position + erased));
+    }
+  }
+
+  BOOST_CHECK_EQUAL(collection.getSize(), expected.size());
+  BOOST_CHECK_EQUAL_COLLECTIONS(collection.begin(), collection.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,278 @@
+#include <VectorBackedList.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+namespace
+{
+
+template <typename Collection>
+void thenCollectionContainsValues(const Collection& collection, std::initializer_list<int> expected)
+{
+  BOOST_CHECK_EQUAL_COLLECTIONS(collection.begin(), collection.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(collection.getSize(), expected.size());
+}
+
+struct ThrowingOnCopy
+{
+  static int copiesLeft;
+
+  int value;
+
+  explicit ThrowingOnCopy(int value) : value(value) {}
+
+  ThrowingOnCopy(const ThrowingOnCopy& other) : value(other.value)
+  {
+    if (copiesLeft-- == 0)
+      throw std::runtime_error("copy failed");
+  }
+};
+
+int ThrowingOnCopy::copiesLeft = -1;
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(VectorBackedListTests)
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollection_WhenAddingItemsAtBothEnds_ThenTheyAreLinkedInOrder)
+{
+  aisdi::VectorBackedList<int> collection;
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK(collection.begin() == collection.end());
+
+  collection.append(2);
+  collection.prepend(1);
+  collection.append(4);
+  collection.insert(--collection.end(), 3);
+
+  thenCollectionContainsValues(collection, { 1, 2, 3, 4 });
+  BOOST_CHECK_EQUAL(*(collection.end() - 1), 4);
+  BOOST_CHECK_THROW(--collection.begin(), std::out_of_range);
+  BOOST_CHECK_THROW(*collection.end(), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenErasingAndAddingItems_ThenFreedSlotsAreReused)
+{
+  aisdi::VectorBackedList<int> collection = { 1, 2, 3, 4, 5, 6 };
+  const int* slots = &*collection.begin();
+
+  collection.erase(collection.begin() + 1, collection.begin() + 4);
+  collection.append(7);
+  collection.prepend(0);
+  collection.insert(collection.begin() + 2, 8);
+
+  thenCollectionContainsValues(collection, { 0, 1, 8, 5, 6, 7 });
+  for (const auto& value : collection)
+    BOOST_CHECK(&value >= slots && &value < slots + 6);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenPoppingAndClearing_ThenItStaysConsistent)
+{
+  aisdi::VectorBackedList<std::string> collection = { "a", "b", "c", "d" };
+
+  BOOST_CHECK_EQUAL(collection.popFirst(), "a");
+  BOOST_CHECK_EQUAL(collection.popLast(), "d");
+  BOOST_CHECK_EQUAL(*collection.begin(), "b");
+
+  collection.clear();
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK_THROW(collection.popLast(), std::logic_error);
+  BOOST_CHECK_THROW(collection.erase(collection.end()), std::out_of_range);
+
+  collection.append("e");
+  BOOST_CHECK_EQUAL(collection.popFirst(), "e");
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollectionWithHoles_WhenCopyingAndMoving_ThenContentsFollow)
+{
+  aisdi::VectorBackedList<int> ints = { 1, 2, 3, 4 };
+  ints.erase(ints.begin() + 1);
+  aisdi::VectorBackedList<std::string> strings = { "a", "b", "c" };
+  strings.erase(strings.begin());
+
+  aisdi::VectorBackedList<int> intsCopy{ints};
+  aisdi::VectorBackedList<std::string> stringsCopy{strings};
+  intsCopy.append(5);
+  stringsCopy.append("d");
+
+  thenCollectionContainsValues(ints, { 1, 3, 4 });
+  thenCollectionContainsValues(intsCopy, { 1, 3, 4, 5 });
+  BOOST_CHECK_EQUAL(strings.getSize(), 2u);
+  BOOST_CHECK_EQUAL(*(stringsCopy.end() - 1), "d");
+
+  aisdi::VectorBackedList<int> moved{std::move(intsCopy)};
+  BOOST_CHECK(intsCopy.isEmpty());
+  intsCopy = moved;
+  moved = std::move(ints);
+  thenCollectionContainsValues(moved, { 1, 3, 4 });
+  thenCollectionContainsValues(intsCopy, { 1, 3, 4, 5 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenThrowingCopy_WhenAppendingFails_ThenCollectionIsUnchanged)
+{
+  aisdi::VectorBackedList<ThrowingOnCopy> collection;
+  const ThrowingOnCopy item(1);
+  collection.append(item);
+  collection.append(item);
+
+  ThrowingOnCopy::copiesLeft = 0;
+  BOOST_CHECK_THROW(collection.append(item), std::runtime_error);
+  ThrowingOnCopy::copiesLeft = -1;
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 2u);
+  collection.append(ThrowingOnCopy(2));
+  BOOST_CHECK_EQUAL((*(--collection.end())).value, 2);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenAccessingByIndex_ThenItemsAreFoundFromEitherEnd)
+{
+  aisdi::VectorBackedList<int> collection = { 1, 2, 3, 4, 5, 6 };
+  collection.erase(collection.begin() + 1);
+  collection.insert(collection.begin() + 3, 7);
+  const auto& constCollection = collection;
+
+  BOOST_CHECK_EQUAL(collection.at(0), 1);
+  BOOST_CHECK_EQUAL(collection.at(3), 7);
+  BOOST_CHECK_EQUAL(constCollection.at(5), 6);
+  BOOST_CHECK_THROW(collection.at(6), std::out_of_range);
+  collection.at(1) = 8;
+  BOOST_CHECK_EQUAL(*constCollection.iteratorAt(1), 8);
+  BOOST_CHECK(collection.iteratorAt(6) == collection.end());
+  BOOST_CHECK_THROW(collection.iteratorAt(7), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenSplicingItsOwnRange_ThenItIsRelinkedInPlace)
+{
+  aisdi::VectorBackedList<int> collection = { 1, 2, 3, 4, 5 };
+  const int* moved = &*(collection.begin() + 3);
+
+  collection.splice(collection.begin(), collection, collection.begin() + 3, collection.end());
+  thenCollectionContainsValues(collection, { 4, 5, 1, 2, 3 });
+  BOOST_CHECK_EQUAL(&*collection.begin(), moved);
+
+  collection.splice(collection.begin() + 2, collection, collection.begin() + 1, collection.begin() + 4);
+  collection.splice(collection.begin() + 1, collection, collection.begin() + 1, collection.begin() + 4);
+  collection.splice(collection.begin() + 4, collection, collection.begin() + 1, collection.begin() + 4);
+  thenCollectionContainsValues(collection, { 4, 5, 1, 2, 3 });
+  BOOST_CHECK_EQUAL(*(collection.end() - 1), 3);
+}
+
+BOOST_AUTO_TEST_CASE(GivenTwoCollections_WhenSplicingAndSplitting_ThenItemsMoveBetweenThem)
+{
+  aisdi::VectorBackedList<std::string> collection = { "a", "e" };
+  aisdi::VectorBackedList<std::string> other = { "x", "b", "c", "d", "y" };
+
+  collection.splice(collection.begin() + 1, other, other.begin() + 1, other.end() - 1);
+  BOOST_CHECK_EQUAL(collection.getSize(), 5u);
+  BOOST_CHECK_EQUAL(collection.at(3), "d");
+  BOOST_CHECK_EQUAL(other.getSize(), 2u);
+  BOOST_CHECK_EQUAL(*other.begin(), "x");
+
+  collection.concatenate(other);
+  BOOST_CHECK(other.isEmpty());
+  const std::vector<std::string> expected = { "a", "b", "c", "d", "e", "x", "y" };
+  BOOST_CHECK_EQUAL_COLLECTIONS(collection.begin(), collection.end(), expected.begin(), expected.end());
+
+  aisdi::VectorBackedList<std::string> rest = collection.splitAt(collection.begin() + 5);
+  BOOST_CHECK_EQUAL(collection.getSize(), 5u);
+  BOOST_CHECK_EQUAL(rest.getSize(), 2u);
+  BOOST_CHECK_EQUAL(*rest.begin(), "x");
+
+  const std::string* first = &*collection.begin();
+  aisdi::VectorBackedList<std::string> whole = collection.splitAt(collection.begin());
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK_EQUAL(&*whole.begin(), first);
+  BOOST_CHECK_EQUAL(whole.getSize(), 5u);
+  collection.append("z");
+  BOOST_CHECK_EQUAL(collection.at(0), "z");
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenSorting_ThenOrderIsStableAndValuesStayInTheirSlots)
+{
+  std::mt19937 generator(19);
+  aisdi::VectorBackedList<std::pair<int, int>> collection;
+  std::vector<std::pair<int, int>> expected;
+  for (int i = 0; i < 1000; ++i)
+  {
+    collection.append(std::make_pair(static_cast<int>(generator() % 50), i));
+    expected.push_back(collection.at(collection.getSize() - 1));
+  }
+  collection.erase(collection.begin() + 10);
+  expected.erase(expected.begin() + 10);
+  const auto byKey = [](const std::pair<int, int>& a, const std::pair<int, int>& b) { return a.first < b.first; };
+  const auto tracked = collection.iteratorAt(500);
+  const auto trackedValue = *tracked;
+  const auto* trackedSlot = &*tracked;
+
+  collection.sort(byKey);
+  std::stable_sort(expected.begin(), expected.end(), byKey);
+
+  BOOST_CHECK(std::equal(collection.begin(), collection.end(), expected.begin(), expected.end()));
+  BOOST_CHECK(*tracked == trackedValue);
+  BOOST_CHECK_EQUAL(&*tracked, trackedSlot);
+  BOOST_CHECK(*(collection.end() - 1) == expected.back());
+}
+
+BOOST_AUTO_TEST_CASE(GivenThrowingComparison_WhenSorting_ThenNoItemIsLost)
+{
+  aisdi::VectorBackedList<int> collection;
+  for (int i = 100; i > 0; --i)
+    collection.append(i);
+
+  int comparisonsLeft = 200;
+  BOOST_CHECK_THROW(collection.sort([&](int a, int b) {
+    if (comparisonsLeft-- == 0)
+      throw std::runtime_error("comparison failed");
+    return a < b;
+  }), std::runtime_error);
+
+  std::vector<int> items(collection.begin(), collection.end());
+  BOOST_CHECK_EQUAL(items.size(), 100u);
+  std::sort(items.begin(), items.end());
+  for (int i = 0; i < 100; ++i)
+    BOOST_CHECK_EQUAL(items[i], i + 1);
+  std::vector<int> backwards;
+  for (auto it = collection.end(); it != collection.begin();)
+    backwards.push_back(*--it);
+  BOOST_CHECK(std::equal(backwards.rbegin(), backwards.rend(), collection.begin()));
+
+  collection.sort();
+  BOOST_CHECK(std::is_sorted(collection.begin(), collection.end()));
+}
+
+BOOST_AUTO_TEST_CASE(GivenRandomOperations_WhenComparedWithVector_ThenContentsMatch)
+{
+  std::mt19937 generator(18);
+  aisdi::VectorBackedList<std::string> collection;
+  std::vector<std::string> expected;
+
+  for (int step = 0; step < 3000; ++step)
+  {
+    const std::size_t position = expected.empty() ? 0 : generator() % (expected.size() + 1);
+    if (generator() % 3 != 0 || expected.empty())
+    {
+      collection.insert(collection.begin() + position, std::to_string(step));
+      expected.insert(expected.begin() + position, std::to_string(step));
+    }
+    else
+    {
+      const std::size_t erased = std::min<std::size_t>(generator() % 4, expected.size() - position);
+      collection.erase(collection.begin() + position, collection.begin() + (position + erased));
+      expected.erase(expected.begin() + position, expected.begin() + (position + erased));
+    }
+  }
+
+  BOOST_CHECK_EQUAL(collection.getSize(), expected.size());
+  BOOST_CHECK_EQUAL_COLLECTIONS(collection.begin(), collection.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,9 +1,18 @@
 #include <Vector.h>
 
+#include <algorithm>
 #include <initializer_list>
+#include <iterator>
+#include <limits>
 #include <complex>
 #include <cstdint>
 #include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <memory_resource>
+#include <sstream>
+#include <string>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/test_tools.hpp>
@@ -29,7 +38,7 @@ public:
     ++copiedObjects;
   }
 
-  OperationCountingObject(OperationCountingObject&& other)
+  OperationCountingObject(OperationCountingObject&& other) noexcept
     : value(other.value)
   {
     ++constructedObjects;
@@ -48,7 +57,7 @@ public:
     return *this;
   }
 
-  OperationCountingObject& operator=(OperationCountingObject&& other)
+  OperationCountingObject& operator=(OperationCountingObject&& other) noexcept
   {
     ++assignedObjects;
     ++movedObjects;
@@ -116,6 +125,57 @@ std::ostream& operator<<(std::ostream& out, const OperationCountingObject& obj)
   return out << '<' << static_cast<int>(obj) << '>';
 }
 
+struct RelocatableObject
+{
+  RelocatableObject(int value_) : value(value_), counter(0) {}
+  RelocatableObject(RelocatableObject&& other) noexcept : value(other.value), counter(std::move(other.counter)) {}
+
+  int value;
+  OperationCountingObject counter;
+};
+
+template <typename T>
+class CountingAllocator
+{
+public:
+  using value_type = T;
+
+  explicit CountingAllocator(std::size_t& liveAllocations_)
+    : liveAllocations(&liveAllocations_)
+  {}
+
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U>& other)
+    : liveAllocations(other.liveAllocations)
+  {}
+
+  T* allocate(std::size_t n)
+  {
+    ++*liveAllocations;
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T* p, std::size_t n)
+  {
+    --*liveAllocations;
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  template <typename U>
+  bool operator==(const CountingAllocator<U>& other) const
+  {
+    return liveAllocations == other.liveAllocations;
+  }
+
+  template <typename U>
+  bool operator!=(const CountingAllocator<U>& other) const
+  {
+    return !(*this == other);
+  }
+
+  std::size_t* liveAllocations;
+};
+
 struct Fixture
 {
   Fixture()
@@ -126,6 +186,12 @@ struct Fixture
 
 } // namespace
 
+namespace aisdi
+{
+template <>
+struct is_trivially_relocatable<RelocatableObject> : std::true_type {};
+} // namespace aisdi
+
 template <typename T>
 using LinearCollection = aisdi::Vector<T>;
 
@@ -943,6 +1009,600 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenPrepend_ThenLastElementIs
   BOOST_CHECK_EQUAL(*(collection.begin()), *(--collection.end()));
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenCreatedWithDefaultConstructor_ThenNoItemIsConstructed,
+                              T,
+                              TestedTypes)
+{
+  const LinearCollection<T> collection;
+
+  thenConstructedObjectsCountWas<T>(0);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenFullCollection_WhenAppendingItem_ThenItemsAreMovedToNewStorage,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3 };
+  const T item = 4;
+
+  OperationCountingObject::resetCounters();
+  collection.append(item);
+
+  thenCollectionContainsValues(collection, { 1, 2, 3, 4 });
+  thenCopiedObjectsCountWas<T>(1);
+  thenMovedObjectsCountWas<T>(3);
+  thenDestroyedObjectsCountWas<T>(3);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenInsertingItsOwnElement_ThenItsValueIsInserted,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 10, 20, 30 };
+  collection.append(40);
+
+  collection.insert(begin(collection), *(begin(collection) + 2));
+  collection.insert(begin(collection) + 1, *(begin(collection) + 4));
+
+  thenCollectionContainsValues(collection, { 30, 40, 10, 20, 30, 40 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenTypeWithoutDefaultConstructor_WhenAppendingItems_ThenItemsAreInCollection)
+{
+  struct NotDefaultConstructible
+  {
+    explicit NotDefaultConstructible(int value_) : value(value_) {}
+    int value;
+  };
+
+  LinearCollection<NotDefaultConstructible> collection;
+  for (int i = 0; i < 10; ++i)
+    collection.append(NotDefaultConstructible{i});
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 10);
+  BOOST_CHECK_EQUAL((*(begin(collection) + 9)).value, 9);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenAppendingTemporary_ThenItemIsMovedNotCopied,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+
+  OperationCountingObject::resetCounters();
+  collection.append(T{42});
+
+  thenCollectionContainsValues(collection, { 42 });
+  thenCopiedObjectsCountWas<T>(0);
+  thenMovedObjectsCountWas<T>(1);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenEmplacingItem_ThenItIsConstructedInPlace,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+
+  OperationCountingObject::resetCounters();
+  collection.emplaceAppend(42);
+
+  thenCollectionContainsValues(collection, { 42 });
+  thenConstructedObjectsCountWas<T>(1);
+  thenCopiedObjectsCountWas<T>(0);
+  thenMovedObjectsCountWas<T>(0);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenEmplacingItems_ThenItemsAreAdded,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 10, 20 };
+
+  collection.emplacePrepend(5);
+  collection.emplace(begin(collection) + 2, 15);
+  collection.emplaceAppend(25);
+
+  thenCollectionContainsValues(collection, { 5, 10, 15, 20, 25 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenPopping_ThenItemsAreNotCopied,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3 };
+
+  OperationCountingObject::resetCounters();
+  collection.popFirst();
+  collection.popLast();
+
+  thenCollectionContainsValues(collection, { 2 });
+  thenCopiedObjectsCountWas<T>(0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenMoveOnlyType_WhenAddingAndPoppingItems_ThenItemsAreMoved)
+{
+  LinearCollection<std::unique_ptr<int>> collection;
+
+  collection.append(std::unique_ptr<int>(new int(2)));
+  collection.prepend(std::unique_ptr<int>(new int(1)));
+  for (int i = 3; i < 10; ++i)
+    collection.emplaceAppend(new int(i));
+  collection.erase(begin(collection) + 2);
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 8);
+  BOOST_CHECK_EQUAL(*collection.popFirst(), 1);
+  BOOST_CHECK_EQUAL(*collection.popLast(), 9);
+  BOOST_CHECK_EQUAL(**begin(collection), 2);
+}
+
+BOOST_AUTO_TEST_CASE(GivenTriviallyRelocatableType_WhenGrowingAndShifting_ThenNoItemIsMovedOrDestroyed)
+{
+  OperationCountingObject::resetCounters();
+  {
+    LinearCollection<RelocatableObject> collection;
+    for (int i = 0; i < 10; ++i)
+      collection.emplaceAppend(i);
+    collection.erase(begin(collection) + 1, begin(collection) + 3);
+
+    BOOST_CHECK_EQUAL(collection.getSize(), 8);
+    BOOST_CHECK_EQUAL((*begin(collection)).value, 0);
+    BOOST_CHECK_EQUAL((*(begin(collection) + 1)).value, 3);
+    BOOST_CHECK_EQUAL(OperationCountingObject::movedObjectsCount(), 0);
+    BOOST_CHECK_EQUAL(OperationCountingObject::destroyedObjectsCount(), 2);
+  }
+  BOOST_CHECK_EQUAL(OperationCountingObject::destroyedObjectsCount(), 10);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenReserving_ThenAppendingUpToCapacityDoesNotReallocate,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+
+  collection.reserve(100);
+  OperationCountingObject::resetCounters();
+  for (int i = 0; i < 100; ++i)
+    collection.emplaceAppend(i);
+
+  BOOST_CHECK_EQUAL(collection.getCapacity(), 100);
+  thenMovedObjectsCountWas<T>(0);
+  thenDestroyedObjectsCountWas<T>(0);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenReservingLessThanCapacity_ThenNothingHappens,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3 };
+  collection.reserve(10);
+
+  collection.reserve(5);
+
+  BOOST_CHECK_EQUAL(collection.getCapacity(), 10);
+  thenCollectionContainsValues(collection, { 1, 2, 3 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollectionWithSpareCapacity_WhenShrinking_ThenCapacityEqualsSize,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+  for (int i = 0; i < 50; ++i)
+    collection.append(i);
+  collection.erase(begin(collection) + 3, end(collection));
+
+  collection.shrinkToFit();
+
+  BOOST_CHECK_EQUAL(collection.getCapacity(), 3);
+  thenCollectionContainsValues(collection, { 0, 1, 2 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenShrinking_ThenItCanStillGrow,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+
+  collection.shrinkToFit();
+  collection.append(7);
+
+  BOOST_CHECK_EQUAL(collection.getCapacity(), 4);
+  thenCollectionContainsValues(collection, { 7 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenGrowthPolicies_WhenGrowing_ThenCapacityFollowsPolicy)
+{
+  BOOST_CHECK_EQUAL(aisdi::DoublingGrowth::nextCapacity(4, 5, 8), 9);
+  BOOST_CHECK_EQUAL(aisdi::DoublingGrowth::nextCapacity(4, 20, 8), 20);
+  BOOST_CHECK_EQUAL(aisdi::OneAndHalfGrowth::nextCapacity(7, 8, 8), 11);
+  BOOST_CHECK_EQUAL(aisdi::PageRoundedGrowth<>::nextCapacity(4, 5, 8), 512);
+  BOOST_CHECK_EQUAL(aisdi::PageRoundedGrowth<>::nextCapacity(512, 513, 8), 1536);
+  BOOST_CHECK_EQUAL(aisdi::PageRoundedGrowth<>::nextCapacity(1, 2, 5000), 3);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollectionWithDoublingGrowth_WhenAppending_ThenCapacityDoubles)
+{
+  aisdi::Vector<int, aisdi::DoublingGrowth> collection;
+  collection.shrinkToFit();
+
+  for (int i = 0; i < 5; ++i)
+    collection.append(i);
+
+  BOOST_CHECK_EQUAL(collection.getCapacity(), 9);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollectionWithCustomAllocator_WhenChangingIt_ThenAllMemoryGoesThroughAllocator)
+{
+  std::size_t liveAllocations = 0;
+  {
+    using Collection = aisdi::Vector<int, aisdi::OneAndHalfGrowth, CountingAllocator<int>>;
+    Collection collection{CountingAllocator<int>(liveAllocations)};
+    for (int i = 0; i < 20; ++i)
+      collection.append(i);
+    collection.erase(begin(collection), begin(collection) + 5);
+
+    Collection copy{collection};
+    Collection other{CountingAllocator<int>(liveAllocations)};
+    other = std::move(copy);
+
+    BOOST_CHECK(liveAllocations > 0);
+    BOOST_CHECK_EQUAL(other.getSize(), 15);
+    BOOST_CHECK_EQUAL(*begin(other), 5);
+  }
+  BOOST_CHECK_EQUAL(liveAllocations, 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenPmrCollection_WhenAddingItems_ThenTheyAreAllocatedFromResource)
+{
+  alignas(std::max_align_t) char buffer[4096];
+  std::pmr::monotonic_buffer_resource resource(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+  aisdi::pmr::Vector<int> collection(&resource);
+
+  for (int i = 0; i < 20; ++i)
+    collection.append(i);
+
+  for (const auto& item : collection)
+  {
+    BOOST_CHECK(reinterpret_cast<const char*>(&item) >= buffer);
+    BOOST_CHECK(reinterpret_cast<const char*>(&item) < buffer + sizeof(buffer));
+  }
+  BOOST_CHECK_EQUAL(collection.getSize(), 20);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenIterator_WhenUsingRandomAccessOperations_ThenTheyMatchPointerArithmetic,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 10, 20, 30, 40 };
+
+  auto it = begin(collection);
+  it += 3;
+  BOOST_CHECK_EQUAL(*it, 40);
+  it -= 2;
+  BOOST_CHECK_EQUAL(*it, 20);
+  BOOST_CHECK_EQUAL(it[2], 40);
+  BOOST_CHECK(2 + begin(collection) == begin(collection) + 2);
+  BOOST_CHECK_EQUAL(end(collection) - begin(collection), 4);
+  BOOST_CHECK(begin(collection) < end(collection));
+  BOOST_CHECK(begin(collection) <= begin(collection));
+  BOOST_CHECK(end(collection) > it);
+  BOOST_CHECK(it >= begin(collection));
+  BOOST_CHECK_EQUAL(std::distance(collection.cbegin(), collection.cend()), 4);
+
+  it[1] = 300;
+  thenCollectionContainsValues(collection, { 10, 20, 300, 40 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenIterator_WhenIndexingOutsideCollection_ThenOperationThrows,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 10, 20 };
+
+  BOOST_CHECK_THROW(begin(collection)[2], std::out_of_range);
+  BOOST_CHECK_THROW(end(collection)[-3], std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenSortingWithStdAlgorithm_ThenItemsAreOrdered)
+{
+  LinearCollection<int> collection = { 5, 3, 9, 1, 7 };
+
+  std::sort(begin(collection), end(collection));
+
+  BOOST_CHECK(std::is_sorted(collection.cbegin(), collection.cend()));
+  BOOST_CHECK(std::binary_search(collection.cbegin(), collection.cend(), 7));
+  thenCollectionContainsValues(collection, { 1, 3, 5, 7, 9 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenIterators_WhenCheckingCategory_ThenTheyAreRandomAccess)
+{
+  using Iterator = LinearCollection<int>::iterator;
+  using ConstIterator = LinearCollection<int>::const_iterator;
+
+  BOOST_CHECK((std::is_same<std::iterator_traits<Iterator>::iterator_category,
+                            std::random_access_iterator_tag>::value));
+  BOOST_CHECK((std::is_same<std::iterator_traits<ConstIterator>::iterator_category,
+                            std::random_access_iterator_tag>::value));
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollections_WhenCreatingAndMovingThem_ThenNothingIsAllocated)
+{
+  std::size_t liveAllocations = 0;
+  using Collection = aisdi::Vector<int, aisdi::OneAndHalfGrowth, CountingAllocator<int>>;
+  Collection collection{CountingAllocator<int>(liveAllocations)};
+
+  Collection moved{std::move(collection)};
+  Collection assigned{CountingAllocator<int>(liveAllocations)};
+  assigned = std::move(moved);
+
+  BOOST_CHECK_EQUAL(liveAllocations, 0);
+  BOOST_CHECK(assigned.isEmpty());
+  BOOST_CHECK(std::is_nothrow_move_constructible<LinearCollection<int>>::value);
+  BOOST_CHECK(std::is_nothrow_move_assignable<LinearCollection<int>>::value);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenMovingIt_ThenBothCollectionsRemainUsable,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3 };
+
+  LinearCollection<T> moved{std::move(collection)};
+  collection.append(4);
+  moved.prepend(0);
+  moved.append(5);
+
+  thenCollectionContainsValues(collection, { 4 });
+  thenCollectionContainsValues(moved, { 0, 1, 2, 3, 5 });
+  BOOST_CHECK_EQUAL(*(--end(moved)), 5);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollectionWithSpareCapacity_WhenInsertingRange_ThenEachTailItemIsMovedOnce,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3, 4, 5, 6 };
+  collection.reserve(20);
+  const LinearCollection<T> items = { 7, 8 };
+
+  OperationCountingObject::resetCounters();
+  collection.insert(begin(collection) + 2, begin(items), end(items));
+
+  thenCollectionContainsValues(collection, { 1, 2, 7, 8, 3, 4, 5, 6 });
+  thenMovedObjectsCountWas<T>(4);
+  BOOST_CHECK_EQUAL(collection.getCapacity(), 20);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollectionWithSpareCapacity_WhenInsertingRangeLongerThanTail_ThenItemsAreInserted,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3 };
+  collection.reserve(20);
+
+  OperationCountingObject::resetCounters();
+  collection.insert(begin(collection) + 2, { 7, 8, 9, 10 });
+
+  thenCollectionContainsValues(collection, { 1, 2, 7, 8, 9, 10, 3 });
+  thenMovedObjectsCountWas<T>(1);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenFullCollection_WhenAppendingRange_ThenItGrowsOnce,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3 };
+  std::vector<T> items;
+  for (int i = 4; i <= 100; ++i)
+    items.push_back(i);
+
+  OperationCountingObject::resetCounters();
+  collection.append(items.begin(), items.end());
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 100);
+  BOOST_CHECK_EQUAL(collection.getCapacity(), 100);
+  BOOST_CHECK_EQUAL(*(begin(collection) + 99), 100);
+  thenMovedObjectsCountWas<T>(3);
+  thenCopiedObjectsCountWas<T>(97);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenInsertingEmptyRange_ThenNothingChanges,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2 };
+  const LinearCollection<T> items;
+
+  collection.insert(begin(collection) + 1, begin(items), end(items));
+  collection.append({});
+
+  thenCollectionContainsValues(collection, { 1, 2 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenInsertingInputIteratorRange_ThenItemsAreInserted)
+{
+  LinearCollection<int> collection = { 1, 5 };
+  std::istringstream input("2 3 4");
+
+  collection.insert(begin(collection) + 1, std::istream_iterator<int>(input), std::istream_iterator<int>());
+
+  thenCollectionContainsValues(collection, { 1, 2, 3, 4, 5 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenVariousInputs_WhenSorting_ThenItemsAreOrdered)
+{
+  std::vector<std::vector<int>> inputs = { {}, { 1 }, { 2, 1 } };
+  std::vector<int> random, sorted, reversed, fewKeys;
+  std::uint32_t seed = 20;
+  for (int i = 0; i < 5000; ++i)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    random.push_back(static_cast<int>(seed >> 8));
+    sorted.push_back(i);
+    reversed.push_back(-i);
+    fewKeys.push_back(static_cast<int>(seed >> 28));
+  }
+  inputs.insert(inputs.end(), { random, sorted, reversed, fewKeys });
+
+  for (const auto& input : inputs)
+  {
+    aisdi::Vector<int> collection;
+    aisdi::Vector<int> stableCollection;
+    collection.append(input.begin(), input.end());
+    stableCollection.append(input.begin(), input.end());
+    auto expected = input;
+    std::sort(expected.begin(), expected.end());
+
+    collection.sort();
+    stableCollection.stableSort();
+
+    BOOST_CHECK(std::equal(begin(collection), end(collection), expected.begin(), expected.end()));
+    BOOST_CHECK(std::equal(begin(stableCollection), end(stableCollection), expected.begin(), expected.end()));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GivenEqualKeys_WhenStableSorting_ThenTheirOrderIsKept)
+{
+  aisdi::Vector<std::pair<int, std::string>> collection;
+  std::vector<std::pair<int, std::string>> expected;
+  for (int i = 0; i < 300; ++i)
+  {
+    collection.append({ (i * 7) % 10, std::to_string(i) });
+    expected.push_back({ (i * 7) % 10, std::to_string(i) });
+  }
+
+  const auto byKey = [](const std::pair<int, std::string>& a, const std::pair<int, std::string>& b) {
+    return a.first > b.first;
+  };
+  collection.stableSort(byKey);
+  std::stable_sort(expected.begin(), expected.end(), byKey);
+
+  BOOST_CHECK(std::equal(begin(collection), end(collection), expected.begin(), expected.end()));
+}
+
+BOOST_AUTO_TEST_CASE(GivenThrowingComparison_WhenStableSorting_ThenCollectionKeepsAllItems)
+{
+  aisdi::Vector<std::string> collection;
+  for (int i = 0; i < 100; ++i)
+    collection.append(std::to_string(1000 - i));
+
+  int comparisons = 0;
+  BOOST_CHECK_THROW(collection.stableSort([&](const std::string& a, const std::string& b) {
+                      if (++comparisons == 200)
+                        throw std::runtime_error("comparison failed");
+                      return a < b;
+                    }),
+                    std::runtime_error);
+
+  std::vector<std::string> items(begin(collection), end(collection));
+  std::vector<std::string> expected;
+  for (int i = 0; i < 100; ++i)
+    expected.push_back(std::to_string(1000 - i));
+  std::sort(items.begin(), items.end());
+  std::sort(expected.begin(), expected.end());
+  BOOST_CHECK(items == expected);
+}
+
+template <typename Key>
+std::vector<Key> randomKeys(std::size_t count, std::uint64_t seed)
+{
+  std::vector<Key> keys;
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+    if constexpr (std::is_floating_point<Key>::value)
+      keys.push_back(static_cast<Key>(static_cast<std::int64_t>(seed) / 1e6));
+    else
+      keys.push_back(static_cast<Key>(seed >> 7));
+  }
+  return keys;
+}
+
+using RadixSortedTypes = boost::mpl::list<std::int8_t, std::uint16_t, std::int32_t, std::uint32_t, std::int64_t,
+                                          std::uint64_t, float, double>;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenKeysOfAnySize_WhenRadixSorting_ThenTheyAreOrdered, Key, RadixSortedTypes)
+{
+  for (const std::size_t count : { 0, 1, 2, 3, 17, 31, 32, 33, 1000, 20000 })
+  {
+    const auto keys = randomKeys<Key>(count, count + 1);
+    aisdi::Vector<Key> collection;
+    collection.append(keys.begin(), keys.end());
+    auto expected = keys;
+    std::sort(expected.begin(), expected.end());
+
+    collection.radixSort();
+
+    BOOST_CHECK(std::equal(begin(collection), end(collection), expected.begin(), expected.end()));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GivenSpecialFloats_WhenRadixSorting_ThenTheyAreOrdered)
+{
+  aisdi::Vector<double> collection = { 2.5, -0.0, -1e300, 0.0, std::numeric_limits<double>::infinity(), -3.0,
+                                       -std::numeric_limits<double>::infinity(), 1e-300 };
+  for (int i = 0; i < 40; ++i)
+    collection.append(i % 2 ? i : -i * 0.5);
+
+  collection.radixSort();
+
+  BOOST_CHECK(std::is_sorted(begin(collection), end(collection)));
+  BOOST_CHECK_EQUAL(*begin(collection), -std::numeric_limits<double>::infinity());
+  BOOST_CHECK_EQUAL(*(--end(collection)), std::numeric_limits<double>::infinity());
+}
+
+BOOST_AUTO_TEST_CASE(GivenRecords_WhenRadixSortingByKeyWithScratch_ThenTheyAreOrderedByThatKey)
+{
+  struct Record
+  {
+    std::uint64_t timestamp;
+    int id;
+  };
+  aisdi::Vector<Record> collection;
+  aisdi::Vector<Record> scratch;
+  const auto byTimestamp = [](const Record& record) { return record.timestamp; };
+
+  for (int round = 0; round < 3; ++round)
+  {
+    const auto keys = randomKeys<std::uint64_t>(5000, round);
+    for (std::size_t i = 0; i < keys.size(); ++i)
+      collection.append(Record{ keys[i] % 100000, static_cast<int>(i) });
+
+    collection.radixSort(scratch, byTimestamp);
+
+    BOOST_CHECK_EQUAL(collection.getSize(), 5000u);
+    BOOST_CHECK(scratch.isEmpty());
+    BOOST_CHECK_GE(scratch.getCapacity(), 5000u);
+    BOOST_CHECK(std::is_sorted(begin(collection), end(collection), [](const Record& a, const Record& b) {
+      return a.timestamp < b.timestamp;
+    }));
+    long long idSum = 0;
+    for (const auto& record : collection)
+      idSum += record.id;
+    BOOST_CHECK_EQUAL(idSum, 4999LL * 5000 / 2);
+    collection.erase(begin(collection), end(collection));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GivenRecordsWithEqualKeysAboveNetworkSize_WhenRadixSorting_ThenTheyKeepTheirOrder)
+{
+  struct Record
+  {
+    std::uint16_t key;
+    int id;
+  };
+  aisdi::Vector<Record> collection;
+  const auto keys = randomKeys<std::uint16_t>(1000, 7);
+  for (std::size_t i = 0; i < keys.size(); ++i)
+    collection.append(Record{ static_cast<std::uint16_t>(keys[i] % 16), static_cast<int>(i) });
+
+  collection.radixSort([](const Record& record) { return record.key; });
+
+  BOOST_CHECK(std::is_sorted(begin(collection), end(collection), [](const Record& a, const Record& b) {
+    return a.key < b.key || (a.key == b.key && a.id < b.id);
+  }));
+}
+
 // ConstIterator is tested via Iterator methods.
 // If Iterator methods are to be changed, then new ConstIterator tests are required.
 